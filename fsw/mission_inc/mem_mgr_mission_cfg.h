@@ -37,10 +37,11 @@
 #include "cfe_mission_eds_designparameters.h"
 
 /*
-** Define CRC memory operations. The same CRC is used for all operations. See
-** config.xml for cFE CRC options.
+** Define the CRC type used when MEM_MGR creates a CRC, e.g. the CRC written
+** to dump files. Loads use the CRC type in the file header or command. See
+** the CrcType definition in mem_mgr.xml for the CRC options.
 */
 
-#define MEM_MGR_CRC  CFE_MISSION_ES_CRC_16
+#define MEM_MGR_CRC  MEM_MGR_CrcType_CRC_16
 
 #endif /* _mem_mgr_mission_cfg_ */
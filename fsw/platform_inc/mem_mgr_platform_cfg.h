@@ -53,6 +53,30 @@
 
 #define MEM_MGR_MAX_SYM_LEN  OS_MAX_SYM_LEN
 
+// Number of resolved symbol addresses cached by MEM_MGR
+#define MEM_MGR_SYM_CACHE_ENTRIES  64
+
+// Maximum number of regions in the memory map table. See mem_map.h for details. 
+#define MEM_MGR_MEM_MAP_MAX_REGIONS  32
+
+// Maximum number of entries in the memory dwell table. See mem_dwell.h for details. 
+#define MEM_MGR_DWELL_MAX_ENTRIES  256
+
+
+
+/*
+** Compile switch to include the interrupt lock used by PeekList commands that
+** request coherent samples. OSAL doesn't provide an interrupt lock so it is
+** excluded by default and PeekList commands that request the lock are rejected.
+** A platform that defines the switch must define MEM_MGR_INT_LOCK() and
+** MEM_MGR_INT_UNLOCK() to its BSP's lock and unlock functions, e.g. VxWorks
+** intLock() and intUnlock(). MEM_MGR_INT_LOCK() returns the key passed to
+** MEM_MGR_INT_UNLOCK().
+*/
+//#define MEM_MGR_OPT_INCL_INT_LOCK
+//#define MEM_MGR_INT_LOCK()       ((uint32)intLock())
+//#define MEM_MGR_INT_UNLOCK(Key)  intUnlock((int)(Key))
+
 
 // Maximum number of bytes that can be loaded into RAM with a single memory load command
 #define MEM_MGR_MAX_LOAD_FILE_DATA_RAM (1024 * 1024)
@@ -60,6 +84,15 @@
 //Maximum number of bytes that can be loaded into EEPROM with a single memory load command
 #define MEM_MGR_MAX_LOAD_FILE_DATA_EEPROM (128 * 1024)
 
+// Size of the RAM staging buffer used for single-pass memory loads. Load files with
+// more data than the buffer are CRC verified in a separate pass before memory is loaded.
+#define MEM_MGR_LOAD_STAGING_BUF_SIZE (128 * 1024)
+
+
+// Set to 1 to use CPU CRC instructions when the CPU supports them. Currently only the x86 SSE4.2
+// CRC-32C instruction is used. Set to 0 to always use MEM_CRC's table-driven CRCs.
+#define MEM_MGR_CRC_HW_ACCEL 1
+
 
 // Maximum number of bytes that can be written to a file from RAM with a single memory dump command
 #define MEM_MGR_MAX_DUMP_FILE_DATA_RAM (1024 * 1024)
@@ -70,6 +103,9 @@
 // Maximum number of bytes for a symbol table file dump
 #define MEM_MGR_MAX_DUMP_FILE_DATA_SYMTBL (128 * 1024)
 
+// Maximum number of bytes that can be dumped to telemetry packets with a single dump command
+#define MEM_MGR_MAX_DUMP_TLM_DATA (64 * 1024)
+
 
 // Maximum number of bytes that can be loaded into RAM with a single memory fill command
 #define MEM_MGR_MAX_FILL_DATA_RAM (1024 * 1024)
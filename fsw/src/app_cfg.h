@@ -61,27 +61,48 @@
 #define CFG_APP_CMD_PIPE_NAME   APP_CMD_PIPE_NAME
 #define CFG_APP_CMD_PIPE_DEPTH  APP_CMD_PIPE_DEPTH
 
+#define CFG_MEM_MAP_TBL_FILENAME    MEM_MAP_TBL_FILENAME
+#define CFG_MEM_DWELL_TBL_FILENAME  MEM_DWELL_TBL_FILENAME
+
 #define CFG_MEM_MGR_CMD_TOPICID          MEM_MGR_CMD_TOPICID
 #define CFG_MEM_MGR_SEND_STATUS_TOPICID  BC_SCH_4_SEC_TOPICID        // Use different CFG_ name instead of BC_SCH_4_SEC_TOPICID to localize impact if rate changes 
 #define CFG_MEM_MGR_STATUS_TLM_TOPICID   MEM_MGR_STATUS_TLM_TOPICID
+#define CFG_MEM_MGR_REGION_CRC_TLM_TOPICID  MEM_MGR_REGION_CRC_TLM_TOPICID
+#define CFG_MEM_MGR_DUMP_TLM_TOPICID        MEM_MGR_DUMP_TLM_TOPICID
+#define CFG_MEM_MGR_DWELL_TLM_TOPICID       MEM_MGR_DWELL_TLM_TOPICID
+#define CFG_MEM_MGR_PEEK_LIST_TLM_TOPICID   MEM_MGR_PEEK_LIST_TLM_TOPICID
+#define CFG_MEM_MGR_SEARCH_TLM_TOPICID      MEM_MGR_SEARCH_TLM_TOPICID
+#define CFG_MEM_MGR_COMPARE_TLM_TOPICID     MEM_MGR_COMPARE_TLM_TOPICID
+#define CFG_MEM_MGR_HASH_TREE_TLM_TOPICID   MEM_MGR_HASH_TREE_TLM_TOPICID
 
 #define CFG_MEM_FILE_LOAD_BLOCK_SIZE   MEM_FILE_LOAD_BLOCK_SIZE      // See MEM_FILE_IO_BLOCK_SIZE comments below
 #define CFG_MEM_FILE_DUMP_BLOCK_SIZE   MEM_FILE_DUMP_BLOCK_SIZE      // See MEM_FILE_IO_BLOCK_SIZE comments below
 #define CFG_MEM_FILE_FILL_BLOCK_SIZE   MEM_FILE_FILL_BLOCK_SIZE      // See MEM_FILE_IO_BLOCK_SIZE comments below
+#define CFG_MEM_REGION_BLOCK_SIZE      MEM_REGION_BLOCK_SIZE         // See MEM_FILE_IO_BLOCK_SIZE comments below
+#define CFG_MEMORY_FILL_CHILD_THRESHOLD  MEMORY_FILL_CHILD_THRESHOLD  // Fills with more bytes are performed by the child task
 
 #define CFG_MEM_FILE_CFE_HDR_DESCR     MEM_FILE_CFE_HDR_DESCR
 #define CFG_MEM_FILE_CFE_HDR_SUBTYPE   MEM_FILE_CFE_HDR_SUBTYPE
 #define CFG_MEM_FILE_TASK_BLOCK_LIMIT  MEM_FILE_TASK_BLOCK_LIMIT
 #define CFG_MEM_FILE_TASK_BLOCK_DELAY  MEM_FILE_TASK_BLOCK_DELAY
+#define CFG_MEM_FILE_TASK_DUTY_CYCLE   MEM_FILE_TASK_DUTY_CYCLE      // Percent, 100 disables adaptive pacing
+#define CFG_MEM_FILE_TASK_DUTY_WINDOW  MEM_FILE_TASK_DUTY_WINDOW     // Milliseconds
 
 #define CFG_MEM_FILE_CHILD_NAME        MEM_FILE_CHILD_NAME
 #define CFG_MEM_FILE_CHILD_STACK_SIZE  MEM_FILE_CHILD_STACK_SIZE
 #define CFG_MEM_FILE_CHILD_PRIORITY    MEM_FILE_CHILD_PRIORITY
 #define CFG_MEM_FILE_CHILD_PERF_ID     MEM_FILE_CHILD_PERF_ID
 
+#define CFG_MEM_PIPE_CHILD_NAME        MEM_PIPE_CHILD_NAME
+#define CFG_MEM_PIPE_CHILD_STACK_SIZE  MEM_PIPE_CHILD_STACK_SIZE
+#define CFG_MEM_PIPE_CHILD_PRIORITY    MEM_PIPE_CHILD_PRIORITY
+#define CFG_MEM_PIPE_CHILD_PERF_ID     MEM_PIPE_CHILD_PERF_ID
+
 #define CFG_MEM_TLM_CHILD_NAME         MEM_TLM_CHILD_NAME
 #define CFG_MEM_TLM_CHILD_STACK_SIZE   MEM_TLM_CHILD_STACK_SIZE
 #define CFG_MEM_TLM_CHILD_PRIORITY     MEM_TLM_CHILD_PRIORITY
+#define CFG_MEM_TLM_CHILD_PERF_ID      MEM_TLM_CHILD_PERF_ID
+#define CFG_MEM_DWELL_TICK_MS          MEM_DWELL_TICK_MS             // Dwell table sample periods are in ticks
       
 
 
@@ -90,23 +111,42 @@
    XX(APP_PERF_ID,uint32) \
    XX(APP_CMD_PIPE_NAME,char*) \
    XX(APP_CMD_PIPE_DEPTH,uint32) \
+   XX(MEM_MAP_TBL_FILENAME,char*) \
+   XX(MEM_DWELL_TBL_FILENAME,char*) \
    XX(MEM_MGR_CMD_TOPICID,uint32) \
    XX(BC_SCH_4_SEC_TOPICID,uint32) \
    XX(MEM_MGR_STATUS_TLM_TOPICID,uint32) \
+   XX(MEM_MGR_REGION_CRC_TLM_TOPICID,uint32) \
+   XX(MEM_MGR_DUMP_TLM_TOPICID,uint32) \
+   XX(MEM_MGR_DWELL_TLM_TOPICID,uint32) \
+   XX(MEM_MGR_PEEK_LIST_TLM_TOPICID,uint32) \
+   XX(MEM_MGR_SEARCH_TLM_TOPICID,uint32) \
+   XX(MEM_MGR_COMPARE_TLM_TOPICID,uint32) \
+   XX(MEM_MGR_HASH_TREE_TLM_TOPICID,uint32) \
    XX(MEM_FILE_LOAD_BLOCK_SIZE,uint32) \
    XX(MEM_FILE_DUMP_BLOCK_SIZE,uint32) \
    XX(MEM_FILE_FILL_BLOCK_SIZE,uint32) \
+   XX(MEM_REGION_BLOCK_SIZE,uint32) \
+   XX(MEMORY_FILL_CHILD_THRESHOLD,uint32) \
    XX(MEM_FILE_CFE_HDR_DESCR,char*) \
    XX(MEM_FILE_CFE_HDR_SUBTYPE,uint32) \
    XX(MEM_FILE_TASK_BLOCK_LIMIT,uint32) \
    XX(MEM_FILE_TASK_BLOCK_DELAY,uint32) \
+   XX(MEM_FILE_TASK_DUTY_CYCLE,uint32) \
+   XX(MEM_FILE_TASK_DUTY_WINDOW,uint32) \
    XX(MEM_FILE_CHILD_NAME,char*) \
    XX(MEM_FILE_CHILD_STACK_SIZE,uint32) \
    XX(MEM_FILE_CHILD_PRIORITY,uint32) \
    XX(MEM_FILE_CHILD_PERF_ID,uint32) \
+   XX(MEM_PIPE_CHILD_NAME,char*) \
+   XX(MEM_PIPE_CHILD_STACK_SIZE,uint32) \
+   XX(MEM_PIPE_CHILD_PRIORITY,uint32) \
+   XX(MEM_PIPE_CHILD_PERF_ID,uint32) \
    XX(MEM_TLM_CHILD_NAME,char*) \
    XX(MEM_TLM_CHILD_STACK_SIZE,uint32) \
-   XX(MEM_TLM_CHILD_PRIORITY,uint32)
+   XX(MEM_TLM_CHILD_PRIORITY,uint32) \
+   XX(MEM_TLM_CHILD_PERF_ID,uint32) \
+   XX(MEM_DWELL_TICK_MS,uint32)
 
 DECLARE_ENUM(Config,APP_CONFIG)
 
@@ -121,18 +161,35 @@ DECLARE_ENUM(Config,APP_CONFIG)
 
 #define MEM_MGR_BASE_EID     (APP_C_FW_APP_BASE_EID +  0)
 #define MEMORY_BASE_EID      (APP_C_FW_APP_BASE_EID + 20)
-#define MEM_SIZE8_BASE_EID   (APP_C_FW_APP_BASE_EID + 30)
-#define MEM_SIZE16_BASE_EID  (APP_C_FW_APP_BASE_EID + 40)
-#define MEM_SIZE32_BASE_EID  (APP_C_FW_APP_BASE_EID + 50)
-#define MEM_FILE_BASE_EID    (APP_C_FW_APP_BASE_EID + 60)
+#define MEM_SIZE8_BASE_EID   (APP_C_FW_APP_BASE_EID + 40)
+#define MEM_SIZE16_BASE_EID  (APP_C_FW_APP_BASE_EID + 50)
+#define MEM_SIZE32_BASE_EID  (APP_C_FW_APP_BASE_EID + 60)
+#define MEM_FILE_BASE_EID    (APP_C_FW_APP_BASE_EID + 70)
+#define MEM_PIPE_BASE_EID    (APP_C_FW_APP_BASE_EID + 110)
+#define MEM_REGION_BASE_EID  (APP_C_FW_APP_BASE_EID + 120)
+#define MEM_MAP_BASE_EID     (APP_C_FW_APP_BASE_EID + 130)
+#define MEM_FILL_BASE_EID    (APP_C_FW_APP_BASE_EID + 140)
+#define MEM_DWELL_BASE_EID   (APP_C_FW_APP_BASE_EID + 150)
+#define MEM_SEARCH_BASE_EID  (APP_C_FW_APP_BASE_EID + 160)
+#define MEM_HASH_TREE_BASE_EID  (APP_C_FW_APP_BASE_EID + 170)
+
+
+/******************************************************************************
+** Memory Map Table Macros
+*/
+
+#define MEM_MAP_TBL_NAME              "Memory Map"
+#define MEM_MAP_JSON_FILE_MAX_CHAR    8000
+#define MEM_MAP_JSON_ADDR_STR_LEN       24   // Hex address string, "0x" + 16 digits + NUL fits
+#define MEM_MAP_JSON_ATTR_STR_LEN       16   // Memory type, memory sizes and access strings
 
 
 /******************************************************************************
-** Example Object Table Macros
+** Memory Dwell Table Macros
 */
 
-#define EXOBJTBL_JSON_MAX_OBJ          10
-#define EXOBJTBL_JSON_FILE_MAX_CHAR  2000 
+#define MEM_DWELL_TBL_NAME              "Memory Dwell"
+#define MEM_DWELL_JSON_FILE_MAX_CHAR    32000
 
 /*
 **
@@ -158,25 +215,70 @@ DECLARE_ENUM(Config,APP_CONFIG)
 
 #define MEMORY_DUMP_TOEVENT_MAX_DWORDS   ((MEMORY_DUMP_TOEVENT_MAX_BYTES+3)/4)
   
-/**
- * \brief Dump in an event scratch string size
- *
- * This macro defines the size of the scratch buffer used to build
- * the dump in event message string. Set it to the size of the
- * largest piece shown above including room for a NUL terminator.
- */
-#define MEMORY_DUMP_TOEVENT_TEMP_CHARS 36  // TODO: Consider simple def like CFE_MISSION_EVS_MAX_MESSAGE_LENGTH - MEMORY_DUMP_TOEVENT_HDR_STR.  What is really being protected with a tight definition? Create risk of buffer overflow if get it wrong
 
 /*
 ** This defines the maximum buffer size used for loads, dumps and fill commands. This buffer is used by the child task 
-** and is part of the CPU load balancing scheme. A single buffer is defined because so the worst case child task CPU
-** loading is bounded.
+** and is part of the CPU load balancing scheme. The buffer size bounds the worst case child task CPU loading.
+**
+** File transfers use MEM_PIPE_BUF_CNT buffers of this size so the MEM_PIPE helper task can read or write one block
+** while the MEM_FILE child task copies another block. Two buffers are sufficient to overlap file I/O with memory
+** accesses, more buffers help absorb file system latency jitter.
 **
 ** The JSON init file provides individual load, dump and fill parameter definitions. This allows a finer leven of
 ** tuning. MEM_FILE_TASK_BLOCK_CNT, MEM_FILE_TASK_BLOCK_DELAY and MEM_FILE_CHILD_PRIORITY also impact performance. 
+** When MEM_FILE_TASK_DUTY_CYCLE is less than 100 the MEM_FILE child task adapts its block limit, delay and block
+** size at runtime (see mem_pace.h) and this size is the largest block a transfer uses.
 **
 */
 #define MEM_FILE_IO_BLOCK_SIZE 2048
+#define MEM_PIPE_BUF_CNT          2
+
+/*
+** A symbol is cached in one of MEMORY_SYM_CACHE_PROBES consecutive entries starting at its hash index. Limiting the
+** probe sequence bounds the cache lookup time. When all of the entries are used the symbol replaces the first entry.
+*/
+#define MEMORY_SYM_CACHE_PROBES   4
+
+/*
+** MEM_FILL_PATTERN_MAX_LEN must match the EDS MAX_FILL_PATTERN_LEN definition. Patterns are generated into a
+** MEM_FILL_BLOCK_SIZE stack buffer that must be at least MEM_FILL_PATTERN_MAX_LEN bytes and a multiple of 8.
+*/
+#define MEM_FILL_PATTERN_MAX_LEN    64
+#define MEM_FILL_BLOCK_SIZE        512
+
+/*
+** MEM_SEARCH_PATTERN_MAX_LEN must match the EDS MAX_SEARCH_PATTERN_LEN definition.
+*/
+#define MEM_SEARCH_PATTERN_MAX_LEN  16
+
+/*
+** MEM_FILE_DIFF_RUN_MAX_LEN is the maximum number of bytes in a compare diff
+** file run. Longer runs of differing bytes are split into multiple runs.
+*/
+#define MEM_FILE_DIFF_RUN_MAX_LEN  256
+
+/*
+** MEM_FILE_PATCH_MAX_RECORDS is the maximum number of records in a patch
+** file. The verified record index is held in the MEM_FILE object.
+*/
+#define MEM_FILE_PATCH_MAX_RECORDS  64
+
+/*
+** Delta dumps keep the block CRCs of the last dump of up to MEM_FILE_DELTA_MAX_REGIONS regions. A region's block
+** size is the smallest power of two from MEM_FILE_DELTA_MIN_BLOCK_SIZE up to MEM_FILE_IO_BLOCK_SIZE that divides it
+** into at most MEM_FILE_DELTA_MAX_BLOCKS blocks so regions up to 2MB can have delta dumps.
+*/
+#define MEM_FILE_DELTA_MAX_REGIONS        4
+#define MEM_FILE_DELTA_MAX_BLOCKS      1024
+#define MEM_FILE_DELTA_MIN_BLOCK_SIZE   256
+
+/*
+** MEM_HASH_TREE_MAX_FANOUT must match the EDS MAX_HASH_TREE_TLM_NODES definition so a node's children are always
+** reported in one packet. MEM_HASH_TREE_MAX_LEAVES sizes the hash tree held in the MEM_REGION object, a 1MB region
+** with 256 byte leaves uses every leaf.
+*/
+#define MEM_HASH_TREE_MAX_FANOUT    64
+#define MEM_HASH_TREE_MAX_LEAVES  4096
 
 /******************************************************************************
 ** Function: MEM_MGR_strnlen
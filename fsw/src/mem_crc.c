@@ -0,0 +1,321 @@
+/*
+**  Copyright 2022 bitValence, Inc.
+**  All Rights Reserved.
+**
+**  This program is free software; you can modify and/or redistribute it
+**  under the terms of the GNU Affero General Public License
+**  as published by the Free Software Foundation; version 3 with
+**  attribution addendums as found in the LICENSE.txt
+**
+**  This program is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU Affero General Public License for more details.
+**
+**  Purpose:
+**    Implement the MEM_CRC_Class methods
+**
+**  Notes:
+**    1. All of the CRCs are bit reflected so the same slicing-by-8 method
+**       is used for each CRC width. Table 0 is the classic bytewise table
+**       and table k advances table 0's result by k additional zero bytes.
+**       Each slicing iteration folds 8 data bytes with 8 table lookups.
+**    2. Data bytes are assembled explicitly in little endian order so the
+**       code is independent of the CPU's endianess and alignment rules.
+**
+*/
+
+/*
+** Include Files:
+*/
+
+#include <string.h>
+#include "mem_crc.h"
+
+#if (MEM_MGR_CRC_HW_ACCEL == 1) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define MEM_CRC_X86_SSE42
+#include <nmmintrin.h>
+#endif
+
+
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+#define CRC16_POLY   0xA001      /* CRC-16/ARC, 0x8005 reflected, same as cFE    */
+#define CRC32_POLY   0xEDB88320  /* CRC-32 (ISO-HDLC), 0x04C11DB7 reflected      */
+#define CRC32C_POLY  0x82F63B78  /* CRC-32C (Castagnoli), 0x1EDC6F41 reflected   */
+
+
+/*******************************/
+/** Local Function Prototypes **/
+/*******************************/
+
+static void   BuildCrc16Tbl(uint16 Tbl[MEM_CRC_SLICES][256], uint16 Poly);
+static void   BuildCrc32Tbl(uint32 Tbl[MEM_CRC_SLICES][256], uint32 Poly);
+static uint32 Crc16Slice8(const uint8 *BufPtr, size_t DataLength, uint16 Crc);
+static uint32 Crc32Slice8(const uint8 *BufPtr, size_t DataLength, uint32 Crc, const uint32 Tbl[MEM_CRC_SLICES][256]);
+#ifdef MEM_CRC_X86_SSE42
+static uint32 Crc32cSse42(const uint8 *BufPtr, size_t DataLength, uint32 Crc);
+#endif
+
+
+/**********************/
+/** Global File Data **/
+/**********************/
+
+static MEM_CRC_Class_t *MemCrc = NULL;
+
+
+/******************************************************************************
+** Function: MEM_CRC_Constructor
+**
+*/
+void MEM_CRC_Constructor(MEM_CRC_Class_t *MemCrcPtr)
+{
+
+   MemCrc = MemCrcPtr;
+
+   CFE_PSP_MemSet((void*)MemCrc, 0, sizeof(MEM_CRC_Class_t));
+
+   BuildCrc16Tbl(MemCrc->Crc16Tbl,  CRC16_POLY);
+   BuildCrc32Tbl(MemCrc->Crc32Tbl,  CRC32_POLY);
+   BuildCrc32Tbl(MemCrc->Crc32cTbl, CRC32C_POLY);
+
+#ifdef MEM_CRC_X86_SSE42
+   __builtin_cpu_init();
+   MemCrc->HwCrc32c = __builtin_cpu_supports("sse4.2");
+#endif
+
+} /* End MEM_CRC_Constructor() */
+
+
+/******************************************************************************
+** Function: MEM_CRC_Calculate
+**
+** Notes:
+**   1. The CRC-32 variants are inverted on entry and exit so a 0 InputCrc
+**      provides the standard initial value and chained calls produce the
+**      same result as a single call over all of the data.
+**
+*/
+uint32 MEM_CRC_Calculate(const void *DataPtr, size_t DataLength, uint32 InputCrc,
+                         MEM_MGR_CrcType_Enum_t CrcType)
+{
+
+   uint32 Crc = 0;
+   const uint8 *BufPtr = (const uint8 *)DataPtr;
+
+   switch (CrcType)
+   {
+      case MEM_MGR_CrcType_CRC_16:
+         Crc = Crc16Slice8(BufPtr, DataLength, (uint16)InputCrc);
+         break;
+      case MEM_MGR_CrcType_CRC_32:
+         Crc = ~Crc32Slice8(BufPtr, DataLength, ~InputCrc, MemCrc->Crc32Tbl);
+         break;
+      case MEM_MGR_CrcType_CRC_32C:
+#ifdef MEM_CRC_X86_SSE42
+         if (MemCrc->HwCrc32c)
+         {
+            Crc = ~Crc32cSse42(BufPtr, DataLength, ~InputCrc);
+            break;
+         }
+#endif
+         Crc = ~Crc32Slice8(BufPtr, DataLength, ~InputCrc, MemCrc->Crc32cTbl);
+         break;
+      default:
+         break;
+   } /* End CrcType switch */
+
+   return Crc;
+
+} /* End MEM_CRC_Calculate() */
+
+
+/******************************************************************************
+** Function: MEM_CRC_ValidType
+**
+*/
+bool MEM_CRC_ValidType(MEM_MGR_CrcType_Enum_t CrcType)
+{
+
+   return ((CrcType == MEM_MGR_CrcType_CRC_16) ||
+           (CrcType == MEM_MGR_CrcType_CRC_32) ||
+           (CrcType == MEM_MGR_CrcType_CRC_32C));
+
+} /* End MEM_CRC_ValidType() */
+
+
+/******************************************************************************
+** Function: BuildCrc16Tbl
+**
+*/
+static void BuildCrc16Tbl(uint16 Tbl[MEM_CRC_SLICES][256], uint16 Poly)
+{
+
+   uint16 Crc;
+   int    Bit;
+   int    n, k;
+
+   for (n = 0; n < 256; n++)
+   {
+      Crc = n;
+      for (Bit = 0; Bit < 8; Bit++)
+      {
+         Crc = (Crc & 1) ? ((Crc >> 1) ^ Poly) : (Crc >> 1);
+      }
+      Tbl[0][n] = Crc;
+   }
+
+   for (k = 1; k < MEM_CRC_SLICES; k++)
+   {
+      for (n = 0; n < 256; n++)
+      {
+         Tbl[k][n] = (Tbl[k-1][n] >> 8) ^ Tbl[0][Tbl[k-1][n] & 0xFF];
+      }
+   }
+
+} /* End BuildCrc16Tbl() */
+
+
+/******************************************************************************
+** Function: BuildCrc32Tbl
+**
+*/
+static void BuildCrc32Tbl(uint32 Tbl[MEM_CRC_SLICES][256], uint32 Poly)
+{
+
+   uint32 Crc;
+   int    Bit;
+   int    n, k;
+
+   for (n = 0; n < 256; n++)
+   {
+      Crc = n;
+      for (Bit = 0; Bit < 8; Bit++)
+      {
+         Crc = (Crc & 1) ? ((Crc >> 1) ^ Poly) : (Crc >> 1);
+      }
+      Tbl[0][n] = Crc;
+   }
+
+   for (k = 1; k < MEM_CRC_SLICES; k++)
+   {
+      for (n = 0; n < 256; n++)
+      {
+         Tbl[k][n] = (Tbl[k-1][n] >> 8) ^ Tbl[0][Tbl[k-1][n] & 0xFF];
+      }
+   }
+
+} /* End BuildCrc32Tbl() */
+
+
+/******************************************************************************
+** Function: Crc16Slice8
+**
+** Notes:
+**   1. The 16-bit CRC only overlaps the first two bytes of each 8 byte
+**      slice, the remaining six bytes are looked up directly.
+**
+*/
+static uint32 Crc16Slice8(const uint8 *BufPtr, size_t DataLength, uint16 Crc)
+{
+
+   const uint16 (*Tbl)[256] = (const uint16 (*)[256])MemCrc->Crc16Tbl;
+
+   while (DataLength >= MEM_CRC_SLICES)
+   {
+      Crc ^= (uint16)(BufPtr[0] | (BufPtr[1] << 8));
+      Crc  = Tbl[7][Crc & 0xFF] ^ Tbl[6][Crc >> 8]  ^
+             Tbl[5][BufPtr[2]]  ^ Tbl[4][BufPtr[3]] ^
+             Tbl[3][BufPtr[4]]  ^ Tbl[2][BufPtr[5]] ^
+             Tbl[1][BufPtr[6]]  ^ Tbl[0][BufPtr[7]];
+
+      BufPtr     += MEM_CRC_SLICES;
+      DataLength -= MEM_CRC_SLICES;
+   }
+
+   while (DataLength-- > 0)
+   {
+      Crc = (Crc >> 8) ^ Tbl[0][(Crc ^ *BufPtr++) & 0xFF];
+   }
+
+   return Crc;
+
+} /* End Crc16Slice8() */
+
+
+/******************************************************************************
+** Function: Crc32Slice8
+**
+*/
+static uint32 Crc32Slice8(const uint8 *BufPtr, size_t DataLength, uint32 Crc,
+                          const uint32 Tbl[MEM_CRC_SLICES][256])
+{
+
+   uint32 Lo;
+   uint32 Hi;
+
+   while (DataLength >= MEM_CRC_SLICES)
+   {
+      Lo = Crc ^ ((uint32)BufPtr[0]        | ((uint32)BufPtr[1] << 8) |
+                 ((uint32)BufPtr[2] << 16) | ((uint32)BufPtr[3] << 24));
+      Hi =        (uint32)BufPtr[4]        | ((uint32)BufPtr[5] << 8) |
+                 ((uint32)BufPtr[6] << 16) | ((uint32)BufPtr[7] << 24);
+
+      Crc = Tbl[7][Lo & 0xFF] ^ Tbl[6][(Lo >> 8) & 0xFF] ^ Tbl[5][(Lo >> 16) & 0xFF] ^ Tbl[4][Lo >> 24] ^
+            Tbl[3][Hi & 0xFF] ^ Tbl[2][(Hi >> 8) & 0xFF] ^ Tbl[1][(Hi >> 16) & 0xFF] ^ Tbl[0][Hi >> 24];
+
+      BufPtr     += MEM_CRC_SLICES;
+      DataLength -= MEM_CRC_SLICES;
+   }
+
+   while (DataLength-- > 0)
+   {
+      Crc = (Crc >> 8) ^ Tbl[0][(Crc ^ *BufPtr++) & 0xFF];
+   }
+
+   return Crc;
+
+} /* End Crc32Slice8() */
+
+
+#ifdef MEM_CRC_X86_SSE42
+/******************************************************************************
+** Function: Crc32cSse42
+**
+** Notes:
+**   1. The target attribute allows the SSE4.2 instructions to be compiled
+**      without enabling them for the rest of the app. The constructor's CPU
+**      check ensures the function is only called when they're supported.
+**
+*/
+__attribute__((target("sse4.2")))
+static uint32 Crc32cSse42(const uint8 *BufPtr, size_t DataLength, uint32 Crc)
+{
+
+#if defined(__x86_64__)
+   uint64 Crc64 = Crc;
+   uint64 Data64;
+
+   while (DataLength >= sizeof(uint64))
+   {
+      memcpy(&Data64, BufPtr, sizeof(uint64));
+      Crc64 = _mm_crc32_u64(Crc64, Data64);
+
+      BufPtr     += sizeof(uint64);
+      DataLength -= sizeof(uint64);
+   }
+   Crc = (uint32)Crc64;
+#endif
+
+   while (DataLength-- > 0)
+   {
+      Crc = _mm_crc32_u8(Crc, *BufPtr++);
+   }
+
+   return Crc;
+
+} /* End Crc32cSse42() */
+#endif
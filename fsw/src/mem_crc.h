@@ -0,0 +1,107 @@
+/*
+**  Copyright 2022 bitValence, Inc.
+**  All Rights Reserved.
+**
+**  This program is free software; you can modify and/or redistribute it
+**  under the terms of the GNU Affero General Public License
+**  as published by the Free Software Foundation; version 3 with
+**  attribution addendums as found in the LICENSE.txt
+**
+**  This program is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU Affero General Public License for more details.
+**
+**  Purpose:
+**    Define the memory CRC engine class
+**
+**  Notes:
+**    1. MEM_CRC replaces CFE_ES_CalculateCRC() for all MEM_MGR integrity
+**       checks. The algorithm is selected by the MEM_MGR CrcType EDS value
+**       that is stored in load/dump file headers and commands.
+**    2. CRC-16 results are identical to CFE_ES_CalculateCRC()'s CRC-16 so
+**       existing load files remain valid. The tables are computed by the
+**       constructor and processed 8 bytes at a time (slicing-by-8).
+**    3. CRC-32C uses the x86 SSE4.2 CRC32 instruction when the CPU supports
+**       it. See MEM_MGR_CRC_HW_ACCEL in mem_mgr_platform_cfg.h.
+**
+*/
+
+#ifndef _mem_crc_
+#define _mem_crc_
+
+/*
+** Includes
+*/
+
+#include "app_cfg.h"
+
+
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+#define MEM_CRC_SLICES  8
+
+
+/**********************/
+/** Type Definitions **/
+/**********************/
+
+
+/******************************************************************************
+** MEM_CRC_Class
+*/
+
+typedef struct
+{
+
+   bool    HwCrc32c;   // CRC-32C hardware instruction available
+
+   uint16  Crc16Tbl[MEM_CRC_SLICES][256];
+   uint32  Crc32Tbl[MEM_CRC_SLICES][256];
+   uint32  Crc32cTbl[MEM_CRC_SLICES][256];
+
+} MEM_CRC_Class_t;
+
+
+/************************/
+/** Exported Functions **/
+/************************/
+
+
+/******************************************************************************
+** Function: MEM_CRC_Constructor
+**
+** Initialize the MEM_CRC object to a known state
+**
+** Notes:
+**   1. This must be called prior to any other function.
+**
+*/
+void MEM_CRC_Constructor(MEM_CRC_Class_t *MemCrcPtr);
+
+
+/******************************************************************************
+** Function: MEM_CRC_Calculate
+**
+** Notes:
+**   1. Same calling convention as CFE_ES_CalculateCRC(). Pass the previous
+**      return value as InputCrc to compute a CRC across multiple blocks and
+**      pass 0 for the first block.
+**   2. Returns 0 for an invalid CrcType. Use MEM_CRC_ValidType() to verify
+**      externally supplied types.
+**
+*/
+uint32 MEM_CRC_Calculate(const void *DataPtr, size_t DataLength, uint32 InputCrc,
+                         MEM_MGR_CrcType_Enum_t CrcType);
+
+
+/******************************************************************************
+** Function: MEM_CRC_ValidType
+**
+*/
+bool MEM_CRC_ValidType(MEM_MGR_CrcType_Enum_t CrcType);
+
+
+#endif /* _mem_crc_ */
@@ -0,0 +1,512 @@
+/*
+**  Copyright 2022 bitValence, Inc.
+**  All Rights Reserved.
+**
+**  This program is free software; you can modify and/or redistribute it
+**  under the terms of the GNU Affero General Public License
+**  as published by the Free Software Foundation; version 3 with
+**  attribution addendums as found in the LICENSE.txt
+**
+**  This program is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU Affero General Public License for more details.
+**
+**  Purpose:
+**    Implement the MEM_DWELL_Class methods
+**
+**  Notes:
+**    1. The MEM_TLM child task is a CHILDMGR callback task. Each callback
+**       delays for one dwell tick and then samples the entries whose
+**       countdown expired.
+**    2. JSON values are loaded into a staging array of strings and numbers
+**       using the same conventions as the memory map table. Offsets are hex
+**       strings because JSON numbers can't represent all 64-bit addresses.
+**
+*/
+
+/*
+** Include Files:
+*/
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mem_dwell.h"
+#include "memory.h"
+
+
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+#define JSON_ENTRY_OBJS  4   // JSON objects per entry
+
+#define DWELL_TLM_MAX_SAMPLES  (sizeof(((MEM_MGR_DwellTlm_Payload_t *)0)->Sample) / sizeof(MEM_MGR_DwellSample_t))
+
+
+/**********************/
+/** Type Definitions **/
+/**********************/
+
+typedef struct
+{
+
+   char   Symbol[sizeof(MEM_MGR_SymbolName_String_t)];
+   char   Offset[MEM_MAP_JSON_ADDR_STR_LEN];
+   uint32 MemSize;
+   uint32 Period;
+
+} JsonEntry_t;
+
+
+/*******************************/
+/** Local Function Prototypes **/
+/*******************************/
+
+static bool LoadEntry(uint16 EntryIdx, const JsonEntry_t *JsonEntry, MEM_DWELL_Set_t *Set);
+static bool LoadJsonData(size_t JsonFileLen);
+static void SampleSet(MEM_DWELL_Set_t *Set);
+static void SendDwellTlm(uint16 SampleCnt);
+static bool TaskCallback(CHILDMGR_Class_t *ChildMgr);
+
+
+/**********************/
+/** Global File Data **/
+/**********************/
+
+static MEM_DWELL_Class_t *MemDwell = NULL;
+
+static JsonEntry_t  JsonEntry[MEM_MGR_DWELL_MAX_ENTRIES];
+static CJSON_Obj_t  JsonTblObjs[MEM_MGR_DWELL_MAX_ENTRIES * JSON_ENTRY_OBJS];
+
+
+/******************************************************************************
+** Function: MEM_DWELL_Constructor
+**
+*/
+int32 MEM_DWELL_Constructor(MEM_DWELL_Class_t *MemDwellPtr, const INITBL_Class_t *IniTbl)
+{
+
+   int32  Status;
+   uint32 i;
+   char   QueryKey[CJSON_MAX_KEY_LEN];
+   CJSON_Obj_t *Obj = JsonTblObjs;
+   CHILDMGR_TaskInit_t ChildTaskInit;
+
+   MemDwell = MemDwellPtr;
+
+   CFE_PSP_MemSet((void*)MemDwell, 0, sizeof(MEM_DWELL_Class_t));
+
+   MemDwell->Enabled = true;
+   MemDwell->TickMs  = INITBL_GetIntConfig(IniTbl, CFG_MEM_DWELL_TICK_MS);
+
+   for (i=0; i < MEM_MGR_DWELL_MAX_ENTRIES; i++)
+   {
+      snprintf(QueryKey, sizeof(QueryKey), "entry[%u].symbol", (unsigned int)i);
+      CJSON_ObjConstructor(Obj++, QueryKey, JSONString, JsonEntry[i].Symbol, sizeof(JsonEntry[i].Symbol));
+      snprintf(QueryKey, sizeof(QueryKey), "entry[%u].offset", (unsigned int)i);
+      CJSON_ObjConstructor(Obj++, QueryKey, JSONString, JsonEntry[i].Offset, sizeof(JsonEntry[i].Offset));
+      snprintf(QueryKey, sizeof(QueryKey), "entry[%u].mem-size", (unsigned int)i);
+      CJSON_ObjConstructor(Obj++, QueryKey, JSONNumber, &JsonEntry[i].MemSize, sizeof(JsonEntry[i].MemSize));
+      snprintf(QueryKey, sizeof(QueryKey), "entry[%u].period", (unsigned int)i);
+      CJSON_ObjConstructor(Obj++, QueryKey, JSONNumber, &JsonEntry[i].Period, sizeof(JsonEntry[i].Period));
+   }
+
+   CFE_MSG_Init(CFE_MSG_PTR(MemDwell->DwellTlm.TelemetryHeader),
+                CFE_SB_ValueToMsgId(INITBL_GetIntConfig(IniTbl, CFG_MEM_MGR_DWELL_TLM_TOPICID)),
+                sizeof(MEM_MGR_DwellTlm_t));
+
+   Status = OS_MutSemCreate(&MemDwell->MutexId, "MEM_MGR_DWELL", 0);
+   if (Status == OS_SUCCESS)
+   {
+
+      /* Child Manager constructor sends error events */
+
+      ChildTaskInit.TaskName  = INITBL_GetStrConfig(IniTbl, CFG_MEM_TLM_CHILD_NAME);
+      ChildTaskInit.PerfId    = INITBL_GetIntConfig(IniTbl, CFG_MEM_TLM_CHILD_PERF_ID);
+      ChildTaskInit.StackSize = INITBL_GetIntConfig(IniTbl, CFG_MEM_TLM_CHILD_STACK_SIZE);
+      ChildTaskInit.Priority  = INITBL_GetIntConfig(IniTbl, CFG_MEM_TLM_CHILD_PRIORITY);
+      Status = CHILDMGR_Constructor(&MemDwell->ChildMgr,
+                                    ChildMgr_TaskMainCallback,
+                                    TaskCallback,
+                                    &ChildTaskInit);
+
+      MemDwell->Initialized = (Status == CFE_SUCCESS);
+   }
+   else
+   {
+      CFE_EVS_SendEvent(MEM_DWELL_CONSTRUCTOR_EID, CFE_EVS_EventType_ERROR,
+                        "Error creating memory dwell mutex, status = 0x%08X",
+                        (unsigned int)Status);
+   }
+
+   return Status;
+
+} /* End MEM_DWELL_Constructor() */
+
+
+/******************************************************************************
+** Function: MEM_DWELL_DisCmd
+**
+*/
+bool MEM_DWELL_DisCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
+{
+
+   MemDwell->Enabled = false;
+
+   CFE_EVS_SendEvent(MEM_DWELL_DIS_EID, CFE_EVS_EventType_INFORMATION,
+                     "Memory dwell disabled");
+
+   return true;
+
+} /* End MEM_DWELL_DisCmd() */
+
+
+/******************************************************************************
+** Function: MEM_DWELL_DumpCmd
+**
+** Notes:
+**  1. The table manager writes the JSON file header and closing brace.
+**
+*/
+bool MEM_DWELL_DumpCmd(osal_id_t FileHandle)
+{
+
+   uint32  i;
+   char    DumpRecord[256];
+   const MEM_DWELL_Set_t *Set;
+
+   OS_MutSemTake(MemDwell->MutexId);
+
+   Set = &MemDwell->Set[MemDwell->ActiveSet];
+
+   sprintf(DumpRecord,"   \"entry\": [");
+   OS_write(FileHandle, DumpRecord, strlen(DumpRecord));
+
+   for (i=0; i < Set->EntryCnt; i++)
+   {
+      /* The 8, 16 and 32 MemSize values are the number of bytes */
+      sprintf(DumpRecord,"%s\n      {\"offset\": \"0x%llX\", \"mem-size\": %u, \"period\": %u}",
+              (i == 0) ? "" : ",", (unsigned long long)Set->Addr[i],
+              (unsigned int)(Set->MemSize[i] * 8), (unsigned int)Set->Period[i]);
+      OS_write(FileHandle, DumpRecord, strlen(DumpRecord));
+   }
+
+   sprintf(DumpRecord,"\n   ]\n");
+   OS_write(FileHandle, DumpRecord, strlen(DumpRecord));
+
+   OS_MutSemGive(MemDwell->MutexId);
+
+   return true;
+
+} /* End MEM_DWELL_DumpCmd() */
+
+
+/******************************************************************************
+** Function: MEM_DWELL_EnaCmd
+**
+*/
+bool MEM_DWELL_EnaCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
+{
+
+   MemDwell->Enabled = true;
+
+   CFE_EVS_SendEvent(MEM_DWELL_ENA_EID, CFE_EVS_EventType_INFORMATION,
+                     "Memory dwell enabled with %u entries",
+                     (unsigned int)MEM_DWELL_EntryCnt());
+
+   return true;
+
+} /* End MEM_DWELL_EnaCmd() */
+
+
+/******************************************************************************
+** Function: MEM_DWELL_EntryCnt
+**
+*/
+uint16 MEM_DWELL_EntryCnt(void)
+{
+
+   return MemDwell->Set[MemDwell->ActiveSet].EntryCnt;
+
+} /* End MEM_DWELL_EntryCnt() */
+
+
+/******************************************************************************
+** Function: MEM_DWELL_LoadCmd
+**
+*/
+bool MEM_DWELL_LoadCmd(TBLMGR_Tbl_t *Tbl, APP_C_FW_TblLoadOptions_Enum_t LoadType, const char *Filename)
+{
+
+   bool RetStatus = false;
+
+   if (MemDwell->Initialized)
+   {
+      CFE_PSP_MemSet(JsonEntry, 0, sizeof(JsonEntry));
+
+      RetStatus = CJSON_ProcessFile(Filename, MemDwell->JsonBuf, MEM_DWELL_JSON_FILE_MAX_CHAR, LoadJsonData);
+   }
+   else
+   {
+      CFE_EVS_SendEvent(MEM_DWELL_LOAD_EID, CFE_EVS_EventType_ERROR,
+                        "Memory dwell load rejected, the dwell task was not initialized");
+   }
+
+   return RetStatus;
+
+} /* End MEM_DWELL_LoadCmd() */
+
+
+/******************************************************************************
+** Function: LoadEntry
+**
+** Notes:
+**   1. Convert a JSON entry into a dwell set entry. The address is verified
+**      with MEMORY_VerifyAddr() so the memory map and symbol table are only
+**      used during the load. Error events are sent for invalid values.
+**   2. Dwell entries must be RAM. Memory mapped I/O defined in the memory map
+**      is read with PSP calls.
+**
+*/
+static bool LoadEntry(uint16 EntryIdx, const JsonEntry_t *JsonEntry, MEM_DWELL_Set_t *Set)
+{
+
+   bool   RetStatus = false;
+   char  *EndPtr;
+   MEM_MGR_SymbolAddr_t    SymbolAddr;
+   MEM_MGR_MemSize_Enum_t  MemSize = MEM_MGR_MemSize_UNDEF;
+   MEMORY_VerifiedMemory_t VerifiedMemory;
+
+   memset(&SymbolAddr, 0, sizeof(SymbolAddr));
+   strncpy(SymbolAddr.Name, JsonEntry->Symbol, sizeof(SymbolAddr.Name) - 1);
+   SymbolAddr.Offset = (MEM_MGR_CpuAddr_Atom_t)strtoull(JsonEntry->Offset, &EndPtr, 16);
+
+   switch (JsonEntry->MemSize)
+   {
+      case 8:  MemSize = MEM_MGR_MemSize_8;  break;
+      case 16: MemSize = MEM_MGR_MemSize_16; break;
+      case 32: MemSize = MEM_MGR_MemSize_32; break;
+      default: break;
+   }
+
+   if (JsonEntry->Offset[0] == '\0' || *EndPtr != '\0')
+   {
+      CFE_EVS_SendEvent(MEM_DWELL_LOAD_EID, CFE_EVS_EventType_ERROR,
+                        "Memory dwell entry[%u] has an invalid offset '%s'",
+                        (unsigned int)EntryIdx, JsonEntry->Offset);
+   }
+   else if (MemSize == MEM_MGR_MemSize_UNDEF)
+   {
+      CFE_EVS_SendEvent(MEM_DWELL_LOAD_EID, CFE_EVS_EventType_ERROR,
+                        "Memory dwell entry[%u] has an invalid memory size %u, must be 8, 16 or 32",
+                        (unsigned int)EntryIdx, (unsigned int)JsonEntry->MemSize);
+   }
+   else if (JsonEntry->Period == 0 || JsonEntry->Period > 0xFFFF)
+   {
+      CFE_EVS_SendEvent(MEM_DWELL_LOAD_EID, CFE_EVS_EventType_ERROR,
+                        "Memory dwell entry[%u] has an invalid period %u, must be 1 to 65535 ticks",
+                        (unsigned int)EntryIdx, (unsigned int)JsonEntry->Period);
+   }
+   else
+   {
+      /* MEMORY_VerifyAddr() sends error events. The 8, 16 and 32 MemSize values are the number of bytes */
+      if (MEMORY_VerifyAddr(SymbolAddr, MEM_MGR_MemType_RAM, MemSize, MemSize,
+                            MEM_MAP_ACCESS_READ, &VerifiedMemory))
+      {
+         Set->Addr[Set->EntryCnt]      = (cpuaddr)VerifiedMemory.CpuAddr;
+         Set->Period[Set->EntryCnt]    = (uint16)JsonEntry->Period;
+         Set->Countdown[Set->EntryCnt] = 1;
+         Set->MemSize[Set->EntryCnt]   = MemSize;
+         Set->Direct[Set->EntryCnt]    = VerifiedMemory.DirectAccess;
+         Set->EntryCnt++;
+         RetStatus = true;
+      }
+      else
+      {
+         CFE_EVS_SendEvent(MEM_DWELL_LOAD_EID, CFE_EVS_EventType_ERROR,
+                           "Memory dwell entry[%u] address verification failed",
+                           (unsigned int)EntryIdx);
+      }
+   }
+
+   return RetStatus;
+
+} /* End LoadEntry() */
+
+
+/******************************************************************************
+** Function: LoadJsonData
+**
+** Notes:
+**   1. The JSON entries are converted into the inactive set which replaces
+**      the active set only if every entry is valid. The child task only
+**      reads the active set so the inactive set can be built without
+**      holding the mutex.
+**   2. Every entry's countdown starts at 1 so all entries are sampled on the
+**      first tick after a load.
+**
+*/
+static bool LoadJsonData(size_t JsonFileLen)
+{
+
+   bool    RetStatus = true;
+   uint32  i;
+   uint8   LoadSet = (MemDwell->ActiveSet == 0) ? 1 : 0;
+   CJSON_Obj_t     *EntryObj;
+   MEM_DWELL_Set_t *Set = &MemDwell->Set[LoadSet];
+
+   MemDwell->JsonFileLen = JsonFileLen;
+
+   for (i=0; i < (MEM_MGR_DWELL_MAX_ENTRIES * JSON_ENTRY_OBJS); i++)
+   {
+      JsonTblObjs[i].Updated = false;
+   }
+   Set->EntryCnt = 0;
+
+   CJSON_LoadObjArray(JsonTblObjs, MEM_MGR_DWELL_MAX_ENTRIES * JSON_ENTRY_OBJS,
+                      MemDwell->JsonBuf, MemDwell->JsonFileLen);
+
+   for (i=0; (i < MEM_MGR_DWELL_MAX_ENTRIES) && RetStatus; i++)
+   {
+      EntryObj = &JsonTblObjs[i * JSON_ENTRY_OBJS];
+      if (EntryObj[1].Updated)
+      {
+         if (EntryObj[2].Updated && EntryObj[3].Updated)
+         {
+            RetStatus = LoadEntry(i, &JsonEntry[i], Set);
+         }
+         else
+         {
+            CFE_EVS_SendEvent(MEM_DWELL_LOAD_EID, CFE_EVS_EventType_ERROR,
+                              "Memory dwell entry[%u] is missing one or more definitions",
+                              (unsigned int)i);
+            RetStatus = false;
+         }
+      }
+   }
+
+   if (RetStatus)
+   {
+      OS_MutSemTake(MemDwell->MutexId);
+      MemDwell->ActiveSet = LoadSet;
+      MemDwell->TickCnt   = 0;
+      OS_MutSemGive(MemDwell->MutexId);
+
+      CFE_EVS_SendEvent(MEM_DWELL_LOAD_EID, CFE_EVS_EventType_INFORMATION,
+                        "Loaded memory dwell table with %u entries", (unsigned int)Set->EntryCnt);
+   }
+
+   return RetStatus;
+
+} /* End LoadJsonData() */
+
+
+/******************************************************************************
+** Function: SampleSet
+**
+** Notes:
+**   1. Called by the child task with the dwell mutex.
+**   2. Direct access entries are read with a single volatile access of the
+**      entry's width by MEMORY_ReadValue(). Other entries use the PSP and a
+**      failed read reports a zero value.
+**
+*/
+static void SampleSet(MEM_DWELL_Set_t *Set)
+{
+
+   MEM_MGR_DwellSample_t *Sample = MemDwell->DwellTlm.Payload.Sample;
+
+   uint16  i;
+   uint16  SampleCnt = 0;
+
+   for (i=0; i < Set->EntryCnt; i++)
+   {
+
+      if (--Set->Countdown[i] != 0)
+      {
+         continue;
+      }
+      Set->Countdown[i] = Set->Period[i];
+
+      if (SampleCnt == 0)
+      {
+         CFE_SB_TimeStampMsg(CFE_MSG_PTR(MemDwell->DwellTlm.TelemetryHeader));
+      }
+
+      Sample[SampleCnt].Value = 0;
+      MEMORY_ReadValue(Set->Addr[i], Set->MemSize[i], Set->Direct[i], &Sample[SampleCnt].Value);
+
+      Sample[SampleCnt].Entry   = i;
+      Sample[SampleCnt].MemSize = Set->MemSize[i];
+      Sample[SampleCnt].Spare   = 0;
+
+      if (++SampleCnt == DWELL_TLM_MAX_SAMPLES)
+      {
+         SendDwellTlm(SampleCnt);
+         SampleCnt = 0;
+      }
+
+   } /* End entry loop */
+
+   if (SampleCnt > 0)
+   {
+      SendDwellTlm(SampleCnt);
+   }
+
+} /* End SampleSet() */
+
+
+/******************************************************************************
+** Function: SendDwellTlm
+**
+** Notes:
+**   1. The packet length only includes the samples that were read.
+**
+*/
+static void SendDwellTlm(uint16 SampleCnt)
+{
+
+   MEM_MGR_DwellTlm_Payload_t *Payload = &MemDwell->DwellTlm.Payload;
+
+   Payload->TickCnt   = MemDwell->TickCnt;
+   Payload->SampleCnt = SampleCnt;
+   Payload->Spare     = 0;
+
+   CFE_MSG_SetSize(CFE_MSG_PTR(MemDwell->DwellTlm.TelemetryHeader),
+                   offsetof(MEM_MGR_DwellTlm_t, Payload.Sample) + SampleCnt * sizeof(MEM_MGR_DwellSample_t));
+   CFE_SB_TransmitMsg(CFE_MSG_PTR(MemDwell->DwellTlm.TelemetryHeader), true);
+
+} /* End SendDwellTlm() */
+
+
+/******************************************************************************
+** Function: TaskCallback
+**
+** Notes:
+**   1. The tick is an OS_TaskDelay() so the sample periods are nominal and
+**      drift by the time it takes to sample the table.
+**   2. TickCnt only advances while dwell is enabled so it identifies the
+**      tick that produced a set of samples.
+**
+*/
+static bool TaskCallback(CHILDMGR_Class_t *ChildMgr)
+{
+
+   OS_TaskDelay(MemDwell->TickMs);
+
+   if (MemDwell->Enabled)
+   {
+      OS_MutSemTake(MemDwell->MutexId);
+
+      MemDwell->TickCnt++;
+      SampleSet(&MemDwell->Set[MemDwell->ActiveSet]);
+
+      OS_MutSemGive(MemDwell->MutexId);
+   }
+
+   return true;
+
+} /* End TaskCallback() */
@@ -0,0 +1,191 @@
+/*
+**  Copyright 2022 bitValence, Inc.
+**  All Rights Reserved.
+**
+**  This program is free software; you can modify and/or redistribute it
+**  under the terms of the GNU Affero General Public License
+**  as published by the Free Software Foundation; version 3 with
+**  attribution addendums as found in the LICENSE.txt
+**
+**  This program is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU Affero General Public License for more details.
+**
+**  Purpose:
+**    Define the memory dwell class
+**
+**  Notes:
+**    1. The memory dwell table is a JSON table of memory locations that are
+**       periodically sampled by the MEM_TLM child task. Each entry defines an
+**       address, a memory size and a sample period in dwell ticks.
+**    2. Addresses are resolved and verified when the table is loaded so the
+**       child task only reads memory. Entries are stored as a structure of
+**       arrays so a dwell tick scans compact countdown and address arrays.
+**    3. Two entry sets are maintained. A table load builds the inactive set
+**       and then swaps the active set index under the dwell mutex so the
+**       child task never samples a partially loaded table.
+**    4. The samples read during a dwell tick are sent in one or more
+**       timestamped dwell telemetry packets.
+**
+*/
+
+#ifndef _mem_dwell_
+#define _mem_dwell_
+
+/*
+** Includes
+*/
+
+#include "app_cfg.h"
+
+
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+
+/*
+** Event Message IDs
+*/
+
+#define MEM_DWELL_CONSTRUCTOR_EID  (MEM_DWELL_BASE_EID + 0)
+#define MEM_DWELL_LOAD_EID         (MEM_DWELL_BASE_EID + 1)
+#define MEM_DWELL_ENA_EID          (MEM_DWELL_BASE_EID + 2)
+#define MEM_DWELL_DIS_EID          (MEM_DWELL_BASE_EID + 3)
+
+
+/**********************/
+/** Type Definitions **/
+/**********************/
+
+
+/******************************************************************************
+** Table Structure
+*/
+
+typedef struct
+{
+
+   uint16   EntryCnt;
+   cpuaddr  Addr[MEM_MGR_DWELL_MAX_ENTRIES];
+   uint16   Period[MEM_MGR_DWELL_MAX_ENTRIES];      // Dwell ticks between samples
+   uint16   Countdown[MEM_MGR_DWELL_MAX_ENTRIES];   // Dwell ticks until the next sample
+   uint8    MemSize[MEM_MGR_DWELL_MAX_ENTRIES];     // MEM_MGR_MemSize_Enum_t
+   bool     Direct[MEM_MGR_DWELL_MAX_ENTRIES];      // Read without PSP calls
+
+} MEM_DWELL_Set_t;
+
+
+/******************************************************************************
+** MEM_DWELL_Class
+*/
+
+typedef struct
+{
+
+   /*
+   ** App Framework References
+   */
+
+   CHILDMGR_Class_t ChildMgr;
+
+   /*
+   ** Telemetry Packets
+   */
+
+   MEM_MGR_DwellTlm_t  DwellTlm;
+
+   /*
+   ** MEM_DWELL State Data
+   */
+
+   bool       Initialized;
+   bool       Enabled;
+   osal_id_t  MutexId;    // Protects the active set index
+
+   uint32     TickMs;
+   uint32     TickCnt;    // Enabled ticks since the last table load
+
+   uint8            ActiveSet;
+   MEM_DWELL_Set_t  Set[2];
+
+   size_t  JsonFileLen;
+   char    JsonBuf[MEM_DWELL_JSON_FILE_MAX_CHAR];
+
+} MEM_DWELL_Class_t;
+
+
+/************************/
+/** Exported Functions **/
+/************************/
+
+
+/******************************************************************************
+** Function: MEM_DWELL_Constructor
+**
+** Initialize the MEM_DWELL object to a known state and create the MEM_TLM
+** child task.
+**
+** Notes:
+**   1. This must be called prior to any other function.
+**   2. Returns CFE_SUCCESS if the mutex and child task were created.
+**   3. Dwell is enabled with an empty table until a table is loaded.
+**
+*/
+int32 MEM_DWELL_Constructor(MEM_DWELL_Class_t *MemDwellPtr, const INITBL_Class_t *IniTbl);
+
+
+/******************************************************************************
+** Function: MEM_DWELL_DisCmd
+**
+*/
+bool MEM_DWELL_DisCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr);
+
+
+/******************************************************************************
+** Function: MEM_DWELL_DumpCmd
+**
+** Notes:
+**  1. Function signature must match TBLMGR_DumpTblFuncPtr_t.
+**  2. Can assume valid table file name because this is a callback from
+**     the app framework table manager that has verified the file.
+**  3. Entries are dumped with their resolved addresses and no symbol names.
+**
+*/
+bool MEM_DWELL_DumpCmd(osal_id_t FileHandle);
+
+
+/******************************************************************************
+** Function: MEM_DWELL_EnaCmd
+**
+*/
+bool MEM_DWELL_EnaCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr);
+
+
+/******************************************************************************
+** Function: MEM_DWELL_EntryCnt
+**
+** Notes:
+**   1. Returns the number of entries in the active set.
+**
+*/
+uint16 MEM_DWELL_EntryCnt(void);
+
+
+/******************************************************************************
+** Function: MEM_DWELL_LoadCmd
+**
+** Notes:
+**  1. Function signature must match TBLMGR_LoadTblFuncPtr_t.
+**  2. Can assume valid table file name because this is a callback from
+**     the app framework table manager that has verified the file.
+**  3. The entries in the file replace all of the current entries for both
+**     replace and update load types. The current entries are unchanged if
+**     any entry is invalid.
+**
+*/
+bool MEM_DWELL_LoadCmd(TBLMGR_Tbl_t *Tbl, APP_C_FW_TblLoadOptions_Enum_t LoadType, const char *Filename);
+
+
+#endif /* _mem_dwell_ */
@@ -20,6 +20,10 @@
 **    2. MEM_FILE_DumpSymTblCmd() doesn't operate on memory but it is
 **       included in this class so it runs in the context of the child
 **       task that performs potentially long duration file operations.
+**    3. The command functions are registered with CHILDMGR and execute in
+**       the MEM_FILE child task. The main task accepts the command
+**       immediately and the command's completion status is reported by the
+**       child task's command counters and the completion event messages.
 **
 */
 
@@ -27,26 +31,81 @@
 ** Include Files:
 */
 
+#include <stdio.h>
 #include <string.h>
 #include "mem_file.h"
-#include "mem_size8.h"
-#include "mem_size16.h"
-#include "mem_size32.h"
+#include "mem_crc.h"
+#include "mem_pipe.h"
 
 #define FILE_PRI_HDR_BYTES  sizeof(CFE_FS_Header_t)
 #define FILE_SEC_HDR_BYTES  sizeof(MEM_MGR_SecFileHdr_t)
 #define FILE_HDR_BYTES      (FILE_PRI_HDR_BYTES+FILE_SEC_HDR_BYTES)
 
+#define DIFF_FILE_CFE_HDR_DESCR  "MEM_MGR Compare Diff File"
+#define REGIONS_FILE_CFE_HDR_DESCR  "MEM_MGR Multi-Region Dump File"
+#define DIFF_FILE_HDR_BYTES      sizeof(MEM_MGR_DiffFileHdr_t)
+#define DIFF_RUN_HDR_BYTES       sizeof(MEM_MGR_DiffRunHdr_t)
+
+#define PATCH_FILE_HDR_BYTES     sizeof(MEM_MGR_PatchFileHdr_t)
+#define PATCH_RECORD_BYTES       sizeof(MEM_MGR_PatchRecord_t)
+
+#define DUMP_SEGMENT_MAX_CNT  999   /* Limited by the 3 digit segment filename number */
+
+#define DUMP_REGIONS_MAX_CNT  (sizeof(((MEM_MGR_DumpRegions_CmdPayload_t *)0)->Region) / PATCH_RECORD_BYTES)
+
+#define DELTA_FILE_HDR_BYTES     sizeof(MEM_MGR_DeltaFileHdr_t)
+#define DELTA_DATA_OFFSET        (FILE_HDR_BYTES+DELTA_FILE_HDR_BYTES)
+#define DELTA_INDEX_ENTRY_BYTES  sizeof(uint32)
+
+#define COMP_BLOCK_HDR_BYTES     sizeof(MEM_MGR_CompBlockHdr_t)
+#define COMP_BLOCK_MAX_RAW_LEN   ((MEM_FILE_IO_BLOCK_SIZE - COMP_BLOCK_HDR_BYTES) & ~3)  /* Keep blocks a multiple of every MemSize */
+
+typedef cpuaddr CompareWord_t;  /* Native CPU word used for XOR compares */
+
 /*******************************/
 /** Local Function Prototypes **/
 /*******************************/
 
-static bool ComputeFileCrc(const char *Filename, osal_id_t FileHandle, APP_C_FW_CrcUint8_Enum_t CrcType, uint32 *Crc);
-static bool CreateDumpFile(const char *Filename, osal_id_t FileHandle, const MEM_MGR_SecFileHdr_t *SecFileHdr, MEM_MGR_CpuAddr_Atom_t SrcCpuAddr);
-static bool DumpMemToFile(MEM_MGR_CpuAddr_Atom_t SrcCpuAddr, osal_id_t FileHandle, const char *Filename, MEM_MGR_MemSize_Enum_t MemSize, uint32 ByteCnt);
-static bool LoadMemFromFile(MEM_MGR_CpuAddr_Atom_t DestAddr, osal_id_t FileHandle, const char *Filename, MEM_MGR_MemSize_Enum_t MemSize, uint32 ByteCnt);
+static void AddDiffByte(uint32 Offset, uint8 Expected, uint8 Actual);
+static void CompareBlock(const uint8 *Expected, const uint8 *Actual, uint32 Offset, uint32 ByteCnt);
+static bool CompareMemWithFile(const char *Filename, osal_id_t FileHandle, const MEM_MGR_SecFileHdr_t *SecFileHdr, MEM_MGR_CpuAddr_Atom_t CpuAddr, bool DirectAccess, uint32 *Crc);
+static uint32 CompressBlock(const uint8 *RawBuf, uint32 RawLen, uint8 *FileBuf);
+static bool ComputeFileCrc(const char *Filename, osal_id_t FileHandle, MEM_MGR_CrcType_Enum_t CrcType, uint32 ByteCnt, uint32 *Crc);
+static bool CreateDiffFile(const char *DiffFilename, const MEM_MGR_SecFileHdr_t *SecFileHdr, MEM_MGR_CpuAddr_Atom_t StartAddr);
+static bool CreateDumpFile(const char *Filename, osal_id_t FileHandle, MEM_MGR_SecFileHdr_t *SecFileHdr, MEM_MGR_CpuAddr_Atom_t SrcCpuAddr, bool DirectAccess);
+static bool CreateRegionsFile(const char *Filename, osal_id_t FileHandle, MEM_MGR_PatchFileHdr_t *PatchFileHdr);
+static bool DecompressLoadFile(const char *Filename, osal_id_t FileHandle, const MEM_MGR_SecFileHdr_t *SecFileHdr, uint8 *StagingBuf, const MEMORY_VerifiedMemory_t *VerifiedMemory, uint32 *Crc);
+static uint32 DeltaBlockSize(uint32 ByteCnt);
+static bool DumpDeltaToFile(MEM_MGR_CpuAddr_Atom_t SrcCpuAddr, osal_id_t FileHandle, const char *Filename, MEM_MGR_MemSize_Enum_t MemSize, bool DirectAccess, uint32 ByteCnt, MEM_MGR_CrcType_Enum_t CrcType, uint32 *Crc);
+static bool DumpMemToFile(MEM_MGR_CpuAddr_Atom_t SrcCpuAddr, osal_id_t FileHandle, const char *Filename, MEM_MGR_MemSize_Enum_t MemSize, bool DirectAccess, uint32 ByteCnt, MEM_MGR_CrcType_Enum_t CrcType, MEM_MGR_Compression_Enum_t Compression, uint32 *Crc);
+static bool DumpMemToPipe(MEM_MGR_CpuAddr_Atom_t SrcCpuAddr, MEM_MGR_MemSize_Enum_t MemSize, bool DirectAccess, uint32 ByteCnt, MEM_MGR_CrcType_Enum_t CrcType, MEM_MGR_Compression_Enum_t Compression, uint32 *Crc);
+static bool DumpSegmentFiles(const char *Filename, const MEM_MGR_SecFileHdr_t *SecFileHdr, const MEMORY_VerifiedMemory_t *VerifiedMemory, uint32 SegmentSize);
+static MEM_FILE_DeltaRegion_t *FindDeltaRegion(MEM_MGR_CpuAddr_Atom_t CpuAddr, uint32 ByteCnt);
+static void FlushDiffRun(void);
+static bool LoadDeltaBlocks(const char *Filename, osal_id_t FileHandle, const MEM_MGR_SecFileHdr_t *SecFileHdr, const MEM_MGR_DeltaFileHdr_t *DeltaFileHdr, const MEMORY_VerifiedMemory_t *VerifiedMemory, bool WriteMem, uint32 *Crc);
+static bool LoadMemFromCompFile(const char *Filename, osal_id_t FileHandle, const MEM_MGR_SecFileHdr_t *SecFileHdr, const MEMORY_VerifiedMemory_t *VerifiedMemory);
+static bool LoadMemFromDeltaFile(const char *Filename, osal_id_t FileHandle, const MEM_MGR_SecFileHdr_t *SecFileHdr, const MEMORY_VerifiedMemory_t *VerifiedMemory);
+static bool LoadMemFromFile(MEM_MGR_CpuAddr_Atom_t DestAddr, osal_id_t FileHandle, const char *Filename, MEM_MGR_MemSize_Enum_t MemSize, bool DirectAccess, uint32 ByteCnt);
+static bool LoadMemFromStagingBuf(MEM_MGR_CpuAddr_Atom_t DestAddr, MEM_MGR_MemSize_Enum_t MemSize, bool DirectAccess, uint32 ByteCnt, uint32 StagingOffset);
+static bool LoadPatchRecords(const char *Filename);
+static bool ProcessCompareFile(const char *Filename, osal_id_t FileHandle, const MEM_MGR_SecFileHdr_t *SecFileHdr, const MEMORY_VerifiedMemory_t *VerifiedMemory, const char *DiffFilename);
 static bool ProcessLoadFile(const char *Filename, osal_id_t FileHandle, MEM_MGR_SecFileHdr_t *SecFileHdr, MEM_MGR_CpuAddr_Atom_t *CpuAddr);
-static bool ValidLoadFile(const char *Filename, osal_id_t FileHandle, const MEM_MGR_SecFileHdr_t *SecFileHdr);
+static bool ProcessPatchFile(const char *Filename, osal_id_t FileHandle, MEM_MGR_PatchFileHdr_t *PatchFileHdr);
+static bool ReadCompBlock(const char *Filename, uint8 *RawBuf, uint32 MaxRawLen, uint32 ElementLen, uint32 *RawLen);
+static bool ReadCompData(const char *Filename, uint32 Len, const uint8 **Data);
+static bool ReadDeltaIndex(const char *Filename, osal_id_t FileHandle, const MEM_MGR_SecFileHdr_t *SecFileHdr, MEM_MGR_DeltaFileHdr_t *DeltaFileHdr);
+static bool ReadLoadFileHdrs(const char *Filename, osal_id_t FileHandle, MEM_MGR_SecFileHdr_t *SecFileHdr);
+static bool ReadPatchIndex(const char *Filename, osal_id_t FileHandle, const MEM_MGR_PatchFileHdr_t *PatchFileHdr);
+static void SaveDeltaRegion(MEM_MGR_CpuAddr_Atom_t CpuAddr, uint32 ByteCnt, uint32 ImageCrc);
+static bool SegmentFilename(char *SegFilename, const char *Filename, uint16 Segment);
+static bool StageFileData(const char *Filename, osal_id_t FileHandle, uint32 ByteCnt, MEM_MGR_CrcType_Enum_t CrcType, uint32 *Crc);
+static bool StageLoadFile(const char *Filename, osal_id_t FileHandle, const MEM_MGR_SecFileHdr_t *SecFileHdr);
+static void UpdateBlockCrcs(const uint8 *Data, uint32 Offset, uint32 Len, MEM_MGR_CrcType_Enum_t CrcType);
+static bool ValidLoadFile(const char *Filename, const MEM_MGR_SecFileHdr_t *SecFileHdr);
+static bool ValidPatchFile(const char *Filename, const MEM_MGR_PatchFileHdr_t *PatchFileHdr);
+static bool VerifyFileCrc(const char *Filename, osal_id_t FileHandle, const MEM_MGR_SecFileHdr_t *SecFileHdr);
+static bool WriteDiffFileHdr(const char *DiffFilename, const MEM_MGR_SecFileHdr_t *SecFileHdr, MEM_MGR_CpuAddr_Atom_t StartAddr);
+static bool WriteSecFileHdrCrc(const char *Filename, osal_id_t FileHandle, const MEM_MGR_SecFileHdr_t *SecFileHdr);
 
 
 /**********************/
@@ -67,15 +126,41 @@ static MEM_FILE_Class_t *MemFile = NULL;
 void MEM_FILE_Constructor(MEM_FILE_Class_t *MemFilePtr, const INITBL_Class_t *IniTbl)
 {
  
+   uint32 DutyPct;
+   uint32 WindowMs;
+   uint32 BlockLimit;
+   
    MemFile = MemFilePtr;
 
    CFE_PSP_MemSet((void*)MemFile, 0, sizeof(MEM_FILE_Class_t));
 
    MemFile->IniTbl = IniTbl;
 
-   MemFile->TaskBlockLimit = INITBL_GetIntConfig(IniTbl, CFG_MEM_FILE_TASK_BLOCK_LIMIT);
-   MemFile->TaskBlockDelay = INITBL_GetIntConfig(IniTbl, CFG_MEM_FILE_TASK_BLOCK_DELAY);
-   MemFile->TaskPerfId     = INITBL_GetIntConfig(IniTbl, CFG_MEM_FILE_CHILD_PERF_ID);
+   CFE_MSG_Init(CFE_MSG_PTR(MemFile->CompareTlm.TelemetryHeader),
+                CFE_SB_ValueToMsgId(INITBL_GetIntConfig(IniTbl, CFG_MEM_MGR_COMPARE_TLM_TOPICID)),
+                sizeof(MEM_MGR_CompareTlm_t));
+
+   DutyPct  = INITBL_GetIntConfig(IniTbl, CFG_MEM_FILE_TASK_DUTY_CYCLE);
+   WindowMs = INITBL_GetIntConfig(IniTbl, CFG_MEM_FILE_TASK_DUTY_WINDOW);
+   if ((DutyPct == 0) || (DutyPct > 100) || (WindowMs == 0))
+   {
+      CFE_EVS_SendEvent(MEM_FILE_CONSTRUCTOR_EID, CFE_EVS_EventType_ERROR,
+                        "JSON init file error: MEM_FILE_TASK_DUTY_CYCLE %u must be 1 to 100 and MEM_FILE_TASK_DUTY_WINDOW %u must be non-zero. Adaptive pacing is disabled.",
+                        (unsigned int)DutyPct, (unsigned int)WindowMs);      
+      DutyPct = 100;
+   }
+   
+   BlockLimit = INITBL_GetIntConfig(IniTbl, CFG_MEM_FILE_TASK_BLOCK_LIMIT);
+   if ((BlockLimit == 0) || (BlockLimit > MEM_PACE_MAX_BLOCK_LIMIT))
+   {
+      CFE_EVS_SendEvent(MEM_FILE_CONSTRUCTOR_EID, CFE_EVS_EventType_ERROR,
+                        "JSON init file error: MEM_FILE_TASK_BLOCK_LIMIT %u must be 1 to %u. It has been limited to the valid range.",
+                        (unsigned int)BlockLimit, (unsigned int)MEM_PACE_MAX_BLOCK_LIMIT);      
+      BlockLimit = (BlockLimit == 0) ? 1 : MEM_PACE_MAX_BLOCK_LIMIT;
+   }
+   MEM_PACE_Constructor(&MemFile->Pace, DutyPct, WindowMs, (uint16)BlockLimit,
+                        INITBL_GetIntConfig(IniTbl, CFG_MEM_FILE_TASK_BLOCK_DELAY),
+                        INITBL_GetIntConfig(IniTbl, CFG_MEM_FILE_CHILD_PERF_ID));
 
    MemFile->LoadBlockSize = INITBL_GetIntConfig(IniTbl, CFG_MEM_FILE_LOAD_BLOCK_SIZE);
    if (MemFile->LoadBlockSize > MEM_FILE_IO_BLOCK_SIZE)
@@ -94,18 +179,137 @@ void MEM_FILE_Constructor(MEM_FILE_Class_t *MemFilePtr, const INITBL_Class_t *In
                         MemFile->DumpBlockSize, MEM_FILE_IO_BLOCK_SIZE);      
       MemFile->DumpBlockSize = MEM_FILE_IO_BLOCK_SIZE;
    }
+   
+} /* End MEM_FILE_Constructor */
 
-   MemFile->FillBlockSize = INITBL_GetIntConfig(IniTbl, CFG_MEM_FILE_FILL_BLOCK_SIZE);
-   if (MemFile->FillBlockSize > MEM_FILE_IO_BLOCK_SIZE)
+
+/******************************************************************************
+** Function: MEM_FILE_CompareCmd
+**
+** Notes:
+**   1. Perform command message level processing, verify and open the files,
+**      and set telemetry response. File content processing is performed by
+**      helper functions.
+**   2. A mismatch between memory and the file isn't a command failure. The
+**      command fails if the compare couldn't be performed or its results
+**      aren't valid.
+**
+*/
+bool MEM_FILE_CompareCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
+{
+   
+   const MEM_MGR_CompareWithFile_CmdPayload_t *CompareCmd = CMDMGR_PAYLOAD_PTR(MsgPtr, MEM_MGR_CompareWithFile_t);
+   MEM_MGR_CompareTlm_Payload_t *Payload = &MemFile->CompareTlm.Payload;
+   
+   bool       RetStatus = false;
+   bool       CompareStatus;
+   bool       DiffFileValid = true;
+   int32      OsStatus;   
+   osal_id_t  FileHandle;
+   char       DiffFilename[OS_MAX_PATH_LEN];
+   MEM_MGR_SecFileHdr_t    SecFileHdr;
+   MEMORY_VerifiedMemory_t VerifiedMemory;
+   
+   CFE_SB_MessageStringGet(DiffFilename, CompareCmd->DiffFilename, NULL, sizeof(DiffFilename), sizeof(CompareCmd->DiffFilename));
+   
+   /* Errors reported by utility so no need for else clauses */
+   if (DiffFilename[0] != '\0')
    {
-      CFE_EVS_SendEvent(MEM_FILE_CONSTRUCTOR_EID, CFE_EVS_EventType_ERROR,
-                        "JSON init file error: MEM_FILE_FILL_BLOCK_SIZE %d has been limited to app_cfg.h's MEM_FILE_IO_BLOCK_SIZE %d. See app_cfg.h for details.",
-                        MemFile->FillBlockSize, MEM_FILE_IO_BLOCK_SIZE);      
-      MemFile->FillBlockSize = MEM_FILE_IO_BLOCK_SIZE;
+      DiffFileValid = FileUtil_VerifyDirForWrite(DiffFilename);
    }
    
-} /* End MEM_FILE_Constructor */
+   if (DiffFileValid && FileUtil_VerifyFileForRead(CompareCmd->Filename))
+   {
+      OsStatus = OS_OpenCreate(&FileHandle, CompareCmd->Filename, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+      if (OsStatus == OS_SUCCESS)
+      {
+         CompareStatus = false;
+         if (ReadLoadFileHdrs(CompareCmd->Filename, FileHandle, &SecFileHdr))
+         {
+            if (SecFileHdr.Compression != MEM_MGR_Compression_NONE)
+            {
+               CFE_EVS_SendEvent(MEM_FILE_COMPARE_CMD_EID, CFE_EVS_EventType_ERROR,
+                                 "Compare file %s is compressed, only uncompressed files can be compared",
+                                 CompareCmd->Filename);
+            }
+            else if (SecFileHdr.DumpType != MEM_MGR_DumpType_FULL)
+            {
+               CFE_EVS_SendEvent(MEM_FILE_COMPARE_CMD_EID, CFE_EVS_EventType_ERROR,
+                                 "Compare file %s is a delta dump, only full dump files can be compared",
+                                 CompareCmd->Filename);
+            }
+            /* MEMORY_VerifyAddr() sends error events */
+            else if (MEMORY_VerifyAddr(SecFileHdr.SymbolAddr, SecFileHdr.MemType, SecFileHdr.MemSize,
+                                  SecFileHdr.ByteCnt, MEM_MAP_ACCESS_READ, &VerifiedMemory))
+            {
+               CompareStatus = ProcessCompareFile(CompareCmd->Filename, FileHandle, &SecFileHdr,
+                                                  &VerifiedMemory, DiffFilename);
+            }
+         }
+         
+         OsStatus = OS_close(FileHandle);
+         if (OsStatus == OS_SUCCESS)
+         {
+            RetStatus = CompareStatus;
+         }
+         else
+         {
+            CFE_EVS_SendEvent(MEM_FILE_COMPARE_CMD_EID, CFE_EVS_EventType_ERROR,
+                              "Error closing memory compare file %s after compare completed, status = 0x%08X",
+                              CompareCmd->Filename, (unsigned int)OsStatus);
+         }
+      }
+      else
+      {
+            CFE_EVS_SendEvent(MEM_FILE_COMPARE_CMD_EID, CFE_EVS_EventType_ERROR,
+                              "Error opening memory compare file %s, status = 0x%08X",
+                              CompareCmd->Filename, (unsigned int)OsStatus);
+      }
+      
+   } /* End if valid files */
+
+   if (RetStatus == true)
+   {
+      Payload->StartAddr     = VerifiedMemory.CpuAddr;
+      Payload->FirstDiffAddr = 0;
+      Payload->ByteCnt       = SecFileHdr.ByteCnt;
+      Payload->MismatchCnt   = MemFile->Diff.MismatchCnt;
+      Payload->RunCnt        = MemFile->Diff.RunCnt;
+      if (Payload->MismatchCnt > 0)
+      {
+         Payload->FirstDiffAddr = VerifiedMemory.CpuAddr + MemFile->Diff.FirstDiffOffset;
+      }
+      CFE_SB_TimeStampMsg(CFE_MSG_PTR(MemFile->CompareTlm.TelemetryHeader));
+      CFE_SB_TransmitMsg(CFE_MSG_PTR(MemFile->CompareTlm.TelemetryHeader), true);
+
+      MemFile->CmdStatus.Function  = MEM_MGR_MemFunction_COMPARE_WITH_FILE;
+      MemFile->CmdStatus.Type      = SecFileHdr.MemType;
+      MemFile->CmdStatus.Size      = SecFileHdr.MemSize;
+      MemFile->CmdStatus.Addr      = VerifiedMemory.CpuAddr;
+      MemFile->CmdStatus.Data      = Payload->MismatchCnt;
+      MemFile->CmdStatus.ByteCnt   = SecFileHdr.ByteCnt;
+      
+      MEMORY_SetCmdStatus(&MemFile->CmdStatus);
+      strncpy(MemFile->Filename, CompareCmd->Filename, OS_MAX_PATH_LEN);
+
+      if (Payload->MismatchCnt == 0)
+      {
+         CFE_EVS_SendEvent(MEM_FILE_COMPARE_CMD_EID, CFE_EVS_EventType_INFORMATION,
+                           "Memory matches %u bytes at address %p in file %s",
+                           (unsigned int)SecFileHdr.ByteCnt, (void *)VerifiedMemory.CpuAddr, CompareCmd->Filename);
+      }
+      else
+      {
+         CFE_EVS_SendEvent(MEM_FILE_COMPARE_CMD_EID, CFE_EVS_EventType_INFORMATION,
+                           "Memory differs from file %s in %u of %u bytes in %u runs, first difference at address %p",
+                           CompareCmd->Filename, (unsigned int)Payload->MismatchCnt, (unsigned int)SecFileHdr.ByteCnt,
+                           (unsigned int)Payload->RunCnt, (void *)Payload->FirstDiffAddr);
+      }
+   }
+    
+   return RetStatus;
 
+} /* End MEM_FILE_CompareCmd() */
 
 /******************************************************************************
 ** Function: MEM_FILE_DumpCmd
@@ -114,6 +318,8 @@ void MEM_FILE_Constructor(MEM_FILE_Class_t *MemFilePtr, const INITBL_Class_t *In
 **   1. Perform command message level processing, verify and open file, and
 **      set telemetry response. File content processing is performed by helper
 **      functions.    
+**   2. The file is truncated when it's opened because compressed and delta
+**      load files must not have data beyond what was dumped.
 **
 */
 bool MEM_FILE_DumpCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
@@ -122,51 +328,114 @@ bool MEM_FILE_DumpCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
    const MEM_MGR_DumpToFile_CmdPayload_t *DumpCmd = CMDMGR_PAYLOAD_PTR(MsgPtr, MEM_MGR_DumpToFile_t);
    
    bool       RetStatus = false;
+   bool       DumpStatus;
    int32      OsStatus;   
    osal_id_t  FileHandle;
+   uint32     SegmentCnt = 0;
+   uint64     CompRatio;
    MEM_MGR_SecFileHdr_t    SecFileHdr;
    MEMORY_VerifiedMemory_t VerifiedMemory;
    
+   memset(&MemFile->DumpStatus, 0, sizeof(MEM_FILE_DumpStatus_t));
+
+   if (DumpCmd->SegmentSize != 0)
+   {
+      SegmentCnt = (DumpCmd->ByteCnt / DumpCmd->SegmentSize) + (((DumpCmd->ByteCnt % DumpCmd->SegmentSize) != 0) ? 1 : 0);
+   }
+
+   if (DumpCmd->Compression > MEM_MGR_Compression_LZ)
+   {
+      CFE_EVS_SendEvent(MEM_FILE_DUMP_CMD_EID, CFE_EVS_EventType_ERROR,
+                        "Dump to file command rejected, invalid compression %d. See mem_mgr.xml Compression for valid values",
+                        DumpCmd->Compression);
+   }
+   else if (DumpCmd->DumpType > MEM_MGR_DumpType_DELTA)
+   {
+      CFE_EVS_SendEvent(MEM_FILE_DUMP_CMD_EID, CFE_EVS_EventType_ERROR,
+                        "Dump to file command rejected, invalid dump type %d. See mem_mgr.xml DumpType for valid values",
+                        DumpCmd->DumpType);
+   }
+   else if ((DumpCmd->DumpType == MEM_MGR_DumpType_DELTA) && (DumpCmd->Compression != MEM_MGR_Compression_NONE))
+   {
+      CFE_EVS_SendEvent(MEM_FILE_DUMP_CMD_EID, CFE_EVS_EventType_ERROR,
+                        "Dump to file command rejected, delta dumps can't be compressed");
+   }
+   else if ((DumpCmd->DumpType == MEM_MGR_DumpType_DELTA) && (DeltaBlockSize(DumpCmd->ByteCnt) == 0))
+   {
+      CFE_EVS_SendEvent(MEM_FILE_DUMP_CMD_EID, CFE_EVS_EventType_ERROR,
+                        "Dump to file command rejected, %u bytes exceeds the %u byte delta dump limit",
+                        (unsigned int)DumpCmd->ByteCnt, (unsigned int)(MEM_FILE_DELTA_MAX_BLOCKS * MEM_FILE_IO_BLOCK_SIZE));
+   }
+   else if ((DumpCmd->SegmentSize != 0) && (DumpCmd->DumpType == MEM_MGR_DumpType_DELTA))
+   {
+      CFE_EVS_SendEvent(MEM_FILE_DUMP_CMD_EID, CFE_EVS_EventType_ERROR,
+                        "Dump to file command rejected, delta dumps can't be segmented");
+   }
+   else if ((DumpCmd->SegmentSize % 4) != 0)
+   {
+      CFE_EVS_SendEvent(MEM_FILE_DUMP_CMD_EID, CFE_EVS_EventType_ERROR,
+                        "Dump to file command rejected, segment size %u must be a multiple of 4",
+                        (unsigned int)DumpCmd->SegmentSize);
+   }
+   else if (SegmentCnt > DUMP_SEGMENT_MAX_CNT)
+   {
+      CFE_EVS_SendEvent(MEM_FILE_DUMP_CMD_EID, CFE_EVS_EventType_ERROR,
+                        "Dump to file command rejected, %u byte segments require %u files, the maximum is %u",
+                        (unsigned int)DumpCmd->SegmentSize, (unsigned int)SegmentCnt, DUMP_SEGMENT_MAX_CNT);
+   }
    /* Errors reported by utility so no need for else clause */
-   if (FileUtil_VerifyDirForWrite(DumpCmd->Filename))
+   else if (FileUtil_VerifyDirForWrite(DumpCmd->Filename))
    {
       if (MEMORY_VerifyAddr(DumpCmd->SymbolAddr, DumpCmd->MemType, DumpCmd->MemSize,
-                            DumpCmd->ByteCnt, &VerifiedMemory))
+                            DumpCmd->ByteCnt, MEM_MAP_ACCESS_READ, &VerifiedMemory))
       {
-         OsStatus = OS_OpenCreate(&FileHandle, DumpCmd->Filename, OS_FILE_FLAG_NONE, OS_READ_WRITE);
-         if (OsStatus == OS_SUCCESS)
-         {         
-            memset(&SecFileHdr, 0, sizeof(MEM_MGR_SecFileHdr_t));
+         memset(&SecFileHdr, 0, sizeof(MEM_MGR_SecFileHdr_t));
 
-            CFE_SB_MessageStringGet(SecFileHdr.SymbolAddr.Name, DumpCmd->SymbolAddr.Name, NULL, 
-                                    sizeof(MEM_MGR_SymbolName_String_t), sizeof(MEM_MGR_SymbolName_String_t));
-            SecFileHdr.SymbolAddr.Offset = DumpCmd->SymbolAddr.Offset;
+         CFE_SB_MessageStringGet(SecFileHdr.SymbolAddr.Name, DumpCmd->SymbolAddr.Name, NULL, 
+                                 sizeof(MEM_MGR_SymbolName_String_t), sizeof(MEM_MGR_SymbolName_String_t));
+         SecFileHdr.SymbolAddr.Offset = DumpCmd->SymbolAddr.Offset;
 
-            SecFileHdr.MemType = DumpCmd->MemType;
-            SecFileHdr.MemSize = DumpCmd->MemSize;
-            SecFileHdr.ByteCnt = DumpCmd->ByteCnt;
-            SecFileHdr.CrcType = APP_C_FW_CrcUint8_CRC_16;
+         SecFileHdr.MemType = DumpCmd->MemType;
+         SecFileHdr.MemSize = DumpCmd->MemSize;
+         SecFileHdr.ByteCnt = DumpCmd->ByteCnt;
+         SecFileHdr.CrcType = MEM_MGR_CRC;
+         SecFileHdr.Compression = DumpCmd->Compression;
+         SecFileHdr.DumpType    = DumpCmd->DumpType;
+         SecFileHdr.SegmentCnt  = (uint16)SegmentCnt;
 
-            CreateDumpFile(DumpCmd->Filename, FileHandle, &SecFileHdr, VerifiedMemory.CpuAddr);
-            
-            OsStatus = OS_close(FileHandle);
+         if (SecFileHdr.SegmentCnt != 0)
+         {
+            MemFile->Delta.BlockSize = 0;
+            RetStatus = DumpSegmentFiles(DumpCmd->Filename, &SecFileHdr, &VerifiedMemory, DumpCmd->SegmentSize);
+         }
+         else
+         {
+            OsStatus = OS_OpenCreate(&FileHandle, DumpCmd->Filename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE);
             if (OsStatus == OS_SUCCESS)
-            {
-               RetStatus = true;
+            {         
+               MemFile->Delta.BlockSize = DeltaBlockSize(SecFileHdr.ByteCnt);
+               DumpStatus = CreateDumpFile(DumpCmd->Filename, FileHandle, &SecFileHdr, VerifiedMemory.CpuAddr,
+                                           VerifiedMemory.DirectAccess);
+               
+               OsStatus = OS_close(FileHandle);
+               if (OsStatus == OS_SUCCESS)
+               {
+                  RetStatus = DumpStatus;
+               }
+               else
+               {
+                  CFE_EVS_SendEvent(MEM_FILE_DUMP_CMD_EID, CFE_EVS_EventType_ERROR,
+                                    "Error closing memory dump to file %s after load completed, status = 0x%08X",
+                                    DumpCmd->Filename, (unsigned int)OsStatus);
+               }
             }
             else
             {
-               CFE_EVS_SendEvent(MEM_FILE_DUMP_CMD_EID, CFE_EVS_EventType_ERROR,
-                                 "Error closing memory dump to file %s after load completed, status = 0x%08X",
-                                 DumpCmd->Filename, (unsigned int)OsStatus);
+                  CFE_EVS_SendEvent(MEM_FILE_DUMP_CMD_EID, CFE_EVS_EventType_ERROR,
+                                    "Error opening memory dump file %s, status = 0x%08X",
+                                    DumpCmd->Filename, (unsigned int)OsStatus);
             }
          }
-         else
-         {
-               CFE_EVS_SendEvent(MEM_FILE_DUMP_CMD_EID, CFE_EVS_EventType_ERROR,
-                                 "Error opening memory dump file %s, status = 0x%08X",
-                                 DumpCmd->Filename, (unsigned int)OsStatus);
-         }
       }      
    } /* End if valid file */
 
@@ -180,7 +449,54 @@ bool MEM_FILE_DumpCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
       MemFile->CmdStatus.ByteCnt   = SecFileHdr.ByteCnt;
       
       MEMORY_SetCmdStatus(&MemFile->CmdStatus);
-      strncpy(MemFile->Filename, DumpCmd->Filename, OS_MAX_PATH_LEN);
+      if (SecFileHdr.SegmentCnt != 0)
+      {
+         SegmentFilename(MemFile->Filename, DumpCmd->Filename, 1);
+      }
+      else
+      {
+         strncpy(MemFile->Filename, DumpCmd->Filename, OS_MAX_PATH_LEN);
+      }
+
+      if (MemFile->Delta.BlockSize != 0)
+      {
+         SaveDeltaRegion(VerifiedMemory.CpuAddr, SecFileHdr.ByteCnt, SecFileHdr.Crc);
+      }
+
+      MemFile->DumpStatus.Compression = SecFileHdr.Compression;
+      MemFile->DumpStatus.DumpType    = SecFileHdr.DumpType;
+      MemFile->DumpStatus.ByteCnt     = SecFileHdr.ByteCnt;
+      MemFile->DumpStatus.SegmentCnt  = SecFileHdr.SegmentCnt;
+      if (MemFile->DumpStatus.FileDataLen != 0)
+      {
+         CompRatio = ((uint64)SecFileHdr.ByteCnt * 100) / MemFile->DumpStatus.FileDataLen;
+         MemFile->DumpStatus.CompRatio = (CompRatio > 0xFFFF) ? 0xFFFF : (uint16)CompRatio;
+      }
+
+      if (SecFileHdr.DumpType == MEM_MGR_DumpType_DELTA)
+      {
+         CFE_EVS_SendEvent(MEM_FILE_DUMP_CMD_EID, CFE_EVS_EventType_INFORMATION,
+                           "Delta dumped %u changed blocks of %u bytes from address %p to file %s, CRC=0x%08X, File data=%u bytes",
+                           (unsigned int)MemFile->DumpStatus.ChangedCnt, (unsigned int)SecFileHdr.ByteCnt,
+                           (void *)VerifiedMemory.CpuAddr, DumpCmd->Filename,
+                           (unsigned int)SecFileHdr.Crc, (unsigned int)MemFile->DumpStatus.FileDataLen);
+      }
+      else if (SecFileHdr.SegmentCnt != 0)
+      {
+         CFE_EVS_SendEvent(MEM_FILE_DUMP_CMD_EID, CFE_EVS_EventType_INFORMATION,
+                           "Dumped %u bytes from address %p to %u segment files starting with %s, File data=%u bytes, Compression ratio=%u.%02u",
+                           (unsigned int)SecFileHdr.ByteCnt, (void *)VerifiedMemory.CpuAddr, SecFileHdr.SegmentCnt,
+                           MemFile->Filename, (unsigned int)MemFile->DumpStatus.FileDataLen,
+                           (unsigned int)(MemFile->DumpStatus.CompRatio/100), (unsigned int)(MemFile->DumpStatus.CompRatio%100));
+      }
+      else
+      {
+         CFE_EVS_SendEvent(MEM_FILE_DUMP_CMD_EID, CFE_EVS_EventType_INFORMATION,
+                           "Dumped %u bytes from address %p to file %s, CRC=0x%08X, File data=%u bytes, Compression ratio=%u.%02u",
+                           (unsigned int)SecFileHdr.ByteCnt, (void *)VerifiedMemory.CpuAddr, DumpCmd->Filename,
+                           (unsigned int)SecFileHdr.Crc, (unsigned int)MemFile->DumpStatus.FileDataLen,
+                           (unsigned int)(MemFile->DumpStatus.CompRatio/100), (unsigned int)(MemFile->DumpStatus.CompRatio%100));
+      }
    }
     
    return RetStatus;
@@ -188,6 +504,131 @@ bool MEM_FILE_DumpCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
 } /* End MEM_FILE_DumpCmd() */
 
 
+/******************************************************************************
+** Function: MEM_FILE_DumpRegionsCmd
+**
+** Notes:
+**   1. Perform command message level processing, verify every region and
+**      open the file, and set telemetry response. File content processing
+**      is performed by CreateRegionsFile().
+**   2. MemFile->Patch holds the region index while the file is written.
+**
+*/
+bool MEM_FILE_DumpRegionsCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
+{
+   
+   const MEM_MGR_DumpRegions_CmdPayload_t *DumpRegionsCmd = CMDMGR_PAYLOAD_PTR(MsgPtr, MEM_MGR_DumpRegions_t);
+   
+   bool       RetStatus = false;
+   bool       DumpStatus;
+   bool       ValidRegions = true;
+   int32      OsStatus;   
+   osal_id_t  FileHandle;
+   uint16     i;
+   MEM_MGR_PatchFileHdr_t  PatchFileHdr;
+   MEM_FILE_Patch_t       *Patch = &MemFile->Patch;
+   const MEM_MGR_PatchRecord_t *Region;
+   
+   memset(&MemFile->DumpStatus, 0, sizeof(MEM_FILE_DumpStatus_t));
+   memset(&PatchFileHdr, 0, sizeof(MEM_MGR_PatchFileHdr_t));
+   Patch->RecordCnt = 0;
+   
+   if ((DumpRegionsCmd->RegionCnt == 0) || (DumpRegionsCmd->RegionCnt > DUMP_REGIONS_MAX_CNT))
+   {
+      CFE_EVS_SendEvent(MEM_FILE_DUMP_REGIONS_CMD_EID, CFE_EVS_EventType_ERROR,
+                        "Dump regions command rejected, region count %u must be between 1 and %u",
+                        DumpRegionsCmd->RegionCnt, (unsigned int)DUMP_REGIONS_MAX_CNT);
+   }
+   /* Errors reported by utility so no need for else clause */
+   else if (FileUtil_VerifyDirForWrite(DumpRegionsCmd->Filename))
+   {
+      for (i=0; (i < DumpRegionsCmd->RegionCnt) && (ValidRegions == true); i++)
+      {
+         Region = &DumpRegionsCmd->Region[i];
+         
+         // Event sent by MEMORY_VerifyAddr()
+         ValidRegions = MEMORY_VerifyAddr(Region->SymbolAddr, Region->MemType, Region->MemSize,
+                                          Region->ByteCnt, MEM_MAP_ACCESS_READ, &Patch->Memory[i]);
+         if (ValidRegions == true)
+         {
+            if (Region->ByteCnt > (0xFFFFFFFF - PatchFileHdr.ByteCnt))
+            {
+               CFE_EVS_SendEvent(MEM_FILE_DUMP_REGIONS_CMD_EID, CFE_EVS_EventType_ERROR,
+                                 "Dump regions command rejected, region %u byte count overflows the file byte count",
+                                 (unsigned int)(i+1));
+               ValidRegions = false;
+            }
+            else
+            {
+               Patch->Record[i] = *Region;
+               CFE_SB_MessageStringGet(Patch->Record[i].SymbolAddr.Name, Region->SymbolAddr.Name, NULL, 
+                                       sizeof(MEM_MGR_SymbolName_String_t), sizeof(MEM_MGR_SymbolName_String_t));
+               PatchFileHdr.ByteCnt += Region->ByteCnt;
+            }
+         }
+      } /* End region loop */
+      
+      if (ValidRegions == true)
+      {
+         Patch->RecordCnt       = DumpRegionsCmd->RegionCnt;
+         PatchFileHdr.RecordCnt = Patch->RecordCnt;
+         PatchFileHdr.CrcType   = MEM_MGR_CRC;
+         
+         OsStatus = OS_OpenCreate(&FileHandle, DumpRegionsCmd->Filename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE);
+         if (OsStatus == OS_SUCCESS)
+         {
+            MemFile->Delta.BlockSize = 0;
+            DumpStatus = CreateRegionsFile(DumpRegionsCmd->Filename, FileHandle, &PatchFileHdr);
+            
+            OsStatus = OS_close(FileHandle);
+            if (OsStatus == OS_SUCCESS)
+            {
+               RetStatus = DumpStatus;
+            }
+            else
+            {
+               CFE_EVS_SendEvent(MEM_FILE_DUMP_REGIONS_CMD_EID, CFE_EVS_EventType_ERROR,
+                                 "Error closing multi-region dump file %s after dump completed, status = 0x%08X",
+                                 DumpRegionsCmd->Filename, (unsigned int)OsStatus);
+            }
+         }
+         else
+         {
+            CFE_EVS_SendEvent(MEM_FILE_DUMP_REGIONS_CMD_EID, CFE_EVS_EventType_ERROR,
+                              "Error opening multi-region dump file %s, status = 0x%08X",
+                              DumpRegionsCmd->Filename, (unsigned int)OsStatus);
+         }
+      } /* End if valid regions */
+   } /* End if valid file */
+
+   if (RetStatus == true)
+   {
+      MemFile->CmdStatus.Function  = MEM_MGR_MemFunction_DUMP_REGIONS;
+      MemFile->CmdStatus.Type      = Patch->Record[0].MemType;
+      MemFile->CmdStatus.Size      = Patch->Record[0].MemSize;
+      MemFile->CmdStatus.Addr      = Patch->Memory[0].CpuAddr;
+      MemFile->CmdStatus.Data      = PatchFileHdr.RecordCnt;
+      MemFile->CmdStatus.ByteCnt   = PatchFileHdr.ByteCnt;
+      
+      MEMORY_SetCmdStatus(&MemFile->CmdStatus);
+      strncpy(MemFile->Filename, DumpRegionsCmd->Filename, OS_MAX_PATH_LEN);
+
+      MemFile->DumpStatus.Compression = MEM_MGR_Compression_NONE;
+      MemFile->DumpStatus.DumpType    = MEM_MGR_DumpType_FULL;
+      MemFile->DumpStatus.ByteCnt     = PatchFileHdr.ByteCnt;
+      MemFile->DumpStatus.CompRatio   = 100;
+
+      CFE_EVS_SendEvent(MEM_FILE_DUMP_REGIONS_CMD_EID, CFE_EVS_EventType_INFORMATION,
+                        "Dumped %u regions with %u bytes to file %s, CRC=0x%08X",
+                        PatchFileHdr.RecordCnt, (unsigned int)PatchFileHdr.ByteCnt,
+                        DumpRegionsCmd->Filename, (unsigned int)PatchFileHdr.Crc);
+   }
+    
+   return RetStatus;
+
+} /* End MEM_FILE_DumpRegionsCmd() */
+
+
 /******************************************************************************
 ** Function: MEM_FILE_DumpSymTblCmd
 **
@@ -253,6 +694,7 @@ bool MEM_FILE_LoadCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
    const MEM_MGR_LoadFromFile_CmdPayload_t *LoadCmd = CMDMGR_PAYLOAD_PTR(MsgPtr, MEM_MGR_LoadFromFile_t);
    
    bool       RetStatus = false;
+   bool       LoadStatus;
    int32      OsStatus;   
    osal_id_t  FileHandle;
    MEM_MGR_SecFileHdr_t    SecFileHdr;
@@ -265,12 +707,12 @@ bool MEM_FILE_LoadCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
       if (OsStatus == OS_SUCCESS)
       {
 
-         ProcessLoadFile(LoadCmd->Filename, FileHandle, &SecFileHdr, &CpuAddr);
+         LoadStatus = ProcessLoadFile(LoadCmd->Filename, FileHandle, &SecFileHdr, &CpuAddr);
          
          OsStatus = OS_close(FileHandle);
          if (OsStatus == OS_SUCCESS)
          {
-            RetStatus = true;
+            RetStatus = LoadStatus;
          }
          else
          {
@@ -299,6 +741,10 @@ bool MEM_FILE_LoadCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
       
       MEMORY_SetCmdStatus(&MemFile->CmdStatus);
       strncpy(MemFile->Filename, LoadCmd->Filename, OS_MAX_PATH_LEN);
+
+      CFE_EVS_SendEvent(MEM_FILE_LOAD_CMD_EID, CFE_EVS_EventType_INFORMATION,
+                        "Loaded %u bytes from file %s to address %p",
+                        (unsigned int)SecFileHdr.ByteCnt, LoadCmd->Filename, (void *)CpuAddr);
    }
     
    return RetStatus;
@@ -307,343 +753,468 @@ bool MEM_FILE_LoadCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
 
 
 /******************************************************************************
-** Function:  MEM_FILE_ResetStatus
-**
-*/
-void MEM_FILE_ResetStatus(void)
-{
-   //TODO: Should anything be reset?
-   
-} /* End MEM_FILE_ResetStatus() */
-
-
-/******************************************************************************
-** Function: ComputeFileCrc
+** Function: MEM_FILE_LoadPatchCmd
 **
 ** Notes:
-**   1. Assumes the file is positioned at the start of the load data. 
-**   2. TaskBlockCount is the count of "task blocks" performed. A task block is 
-**      is group of instructions that is CPU intensive and may need to be 
-**      periodically suspended to prevent CPU hogging.
+**   1. Perform command message level processing, verify and open file, and
+**      set telemetry response. File content processing is performed by helper
+**      functions.
 **
 */
-static bool ComputeFileCrc(const char *Filename, osal_id_t FileHandle, APP_C_FW_CrcUint8_Enum_t CrcType, uint32 *Crc)
+bool MEM_FILE_LoadPatchCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
 {
    
-   bool    CrcComputed  = false;
-   bool    ComputingCrc = true;
-   uint32  CurrentCrc   = 0;
-   int32   FileBytesRead;
+   const MEM_MGR_LoadPatch_CmdPayload_t *LoadPatchCmd = CMDMGR_PAYLOAD_PTR(MsgPtr, MEM_MGR_LoadPatch_t);
    
+   bool       RetStatus = false;
+   bool       LoadStatus;
+   int32      OsStatus;   
+   osal_id_t  FileHandle;
+   MEM_MGR_PatchFileHdr_t  PatchFileHdr;
    
-   MemFile->TaskBlockCount = 0;
-   if (CrcType == MEM_MGR_CRC)
+   /* Errors reported by utility so no need for else clause */
+   if (FileUtil_VerifyFileForRead(LoadPatchCmd->Filename))
    {
-
-      *Crc = 0;   
-      while (ComputingCrc)
+      OsStatus = OS_OpenCreate(&FileHandle, LoadPatchCmd->Filename, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+      if (OsStatus == OS_SUCCESS)
       {
-         
-         FileBytesRead = OS_read(FileHandle, MemFile->IoBuf, MEM_FILE_IO_BLOCK_SIZE);
 
-         if (FileBytesRead == 0) /* Successfully finished reading file */ 
-         {  
-            
-            *Crc = CurrentCrc;
-            ComputingCrc = false;
-            CrcComputed  = true;
-           
-         }
-         else if (FileBytesRead < 0) /* Error reading file */ 
-         {  
-            
-            ComputingCrc = false;            
-            CFE_EVS_SendEvent(MEM_FILE_COMPUTE_FILE_CRC_EID, CFE_EVS_EventType_ERROR,
-                              "File read error %d while computing CRC for file %s",
-                              FileBytesRead, Filename);
+         LoadStatus = ProcessPatchFile(LoadPatchCmd->Filename, FileHandle, &PatchFileHdr);
+         
+         OsStatus = OS_close(FileHandle);
+         if (OsStatus == OS_SUCCESS)
+         {
+            RetStatus = LoadStatus;
          }
          else
          {
-                
-            CurrentCrc = CFE_ES_CalculateCRC(MemFile->IoBuf, FileBytesRead,
-                                             CurrentCrc, CrcType);
-         
-            CHILDMGR_PauseTask(&MemFile->TaskBlockCount, MemFile->TaskBlockLimit, MemFile->TaskBlockDelay, MemFile->TaskPerfId);
-         
-         } /* End if still reading file */
+            CFE_EVS_SendEvent(MEM_FILE_LOAD_PATCH_CMD_EID, CFE_EVS_EventType_ERROR,
+                              "Error closing patch file %s after load completed, status = 0x%08X",
+                              LoadPatchCmd->Filename, (unsigned int)OsStatus);
+         }
+      }
+      else
+      {
+            CFE_EVS_SendEvent(MEM_FILE_LOAD_PATCH_CMD_EID, CFE_EVS_EventType_ERROR,
+                              "Error opening patch file %s, status = 0x%08X",
+                              LoadPatchCmd->Filename, (unsigned int)OsStatus);
+      }
+      
+   } /* End if valid file */
 
-      } /* End while computing CRC */
-   }
-   else
+   if (RetStatus == true)
    {
-            CFE_EVS_SendEvent(MEM_FILE_COMPUTE_FILE_CRC_EID, CFE_EVS_EventType_ERROR,
-                              "Invalid CRC type %d. See cFE ES for valid types.",
-                              CrcType);      
+      MemFile->CmdStatus.Function  = MEM_MGR_MemFunction_LOAD_PATCH;
+      MemFile->CmdStatus.Type      = MemFile->Patch.Record[0].MemType;
+      MemFile->CmdStatus.Size      = MemFile->Patch.Record[0].MemSize;
+      MemFile->CmdStatus.Addr      = MemFile->Patch.Memory[0].CpuAddr;
+      MemFile->CmdStatus.Data      = PatchFileHdr.RecordCnt;
+      MemFile->CmdStatus.ByteCnt   = PatchFileHdr.ByteCnt;
+      
+      MEMORY_SetCmdStatus(&MemFile->CmdStatus);
+      strncpy(MemFile->Filename, LoadPatchCmd->Filename, OS_MAX_PATH_LEN);
+
+      CFE_EVS_SendEvent(MEM_FILE_LOAD_PATCH_CMD_EID, CFE_EVS_EventType_INFORMATION,
+                        "Loaded %u patch records with %u bytes from file %s",
+                        PatchFileHdr.RecordCnt, (unsigned int)PatchFileHdr.ByteCnt, LoadPatchCmd->Filename);
    }
-   
-   return CrcComputed;
-   
-} /* End ComputeCrc() */
+    
+   return RetStatus;
+
+} /* End MEM_FILE_LoadPatchCmd() */
 
 
 /******************************************************************************
-** Function: CreateDumpFile
-**
-** Notes:
-**   1. Perform all file verification before calling the function to perform
-**      the memory dump
+** Function:  MEM_FILE_ResetStatus
 **
 */
-static bool CreateDumpFile(const char *Filename, osal_id_t FileHandle,
-                           const MEM_MGR_SecFileHdr_t *SecFileHdr, MEM_MGR_CpuAddr_Atom_t SrcCpuAddr)
+void MEM_FILE_ResetStatus(void)
 {
+   //TODO: Should anything be reset?
+   
+} /* End MEM_FILE_ResetStatus() */
 
-   bool  RetStatus = false;
-   int32 OsStatus; 
-   CFE_FS_Header_t  CfeFileHeader;
 
-   CFE_FS_InitHeader(&CfeFileHeader, INITBL_GetStrConfig(MemFile->IniTbl, CFG_MEM_FILE_CFE_HDR_DESCR),
-                     INITBL_GetIntConfig(MemFile->IniTbl, CFG_MEM_FILE_CFE_HDR_SUBTYPE));
+/******************************************************************************
+** Function: AddDiffByte
+**
+** Notes:
+**   1. Append a differing byte to the current diff run. The current run is
+**      written when the byte isn't contiguous with it or the run is full.
+**
+*/
+static void AddDiffByte(uint32 Offset, uint8 Expected, uint8 Actual)
+{
    
-   OsStatus = CFE_FS_WriteHeader(FileHandle, &CfeFileHeader);
-   if (OsStatus == FILE_PRI_HDR_BYTES)
+   MEM_FILE_Diff_t *Diff = &MemFile->Diff;
+   
+   if (Diff->MismatchCnt == 0)
    {
-      OsStatus = OS_write(FileHandle, SecFileHdr, FILE_SEC_HDR_BYTES);
-      if (OsStatus == FILE_SEC_HDR_BYTES)
-      {
-         RetStatus = DumpMemToFile(SrcCpuAddr, FileHandle, Filename, SecFileHdr->MemSize, SecFileHdr->ByteCnt);
-      }           
-      else
-      {
-         CFE_EVS_SendEvent(MEM_FILE_CREATE_DUMP_FILE_EID, CFE_EVS_EventType_ERROR,
-                           "Error writing file %s MEM_MGR header. Status=0x%08X, Expected bytes=%u",
-                           Filename, (unsigned int)OsStatus, (unsigned int)FILE_SEC_HDR_BYTES);
+      Diff->FirstDiffOffset = Offset;
+   }
+   Diff->MismatchCnt++;
+   
+   if ((Diff->RunLen != 0) &&
+       (((Diff->RunOffset + Diff->RunLen) != Offset) || (Diff->RunLen == MEM_FILE_DIFF_RUN_MAX_LEN)))
+   {
+      FlushDiffRun();
+   }
+   
+   if (Diff->RunLen == 0)
+   {
+      Diff->RunOffset = Offset;
+   }
+   Diff->RunExpected[Diff->RunLen] = Expected;
+   Diff->RunActual[Diff->RunLen]   = Actual;
+   Diff->RunLen++;
+   
+} /* End AddDiffByte() */
 
-      } /* end OS_read if */
 
-   } /* End valid cFE header read */
-   else
+/******************************************************************************
+** Function: CompareBlock
+**
+** Notes:
+**   1. Offset is the offset of the block from the start of the region.
+**   2. memcmp() screens the block so a matching block is compared with the
+**      C library's widest compares. A differing block is XORed one native
+**      word at a time and only words with a non-zero XOR are compared byte
+**      by byte.
+**
+*/
+static void CompareBlock(const uint8 *Expected, const uint8 *Actual, uint32 Offset, uint32 ByteCnt)
+{
+   
+   uint32  i;
+   uint32  j;
+   CompareWord_t ExpectedWord;
+   CompareWord_t ActualWord;
+   
+   if (memcmp(Expected, Actual, ByteCnt) != 0)
    {
-      CFE_EVS_SendEvent(MEM_FILE_CREATE_DUMP_FILE_EID, CFE_EVS_EventType_ERROR,
-                        "Error writing file %s cFE header. Status=0x%08X, Expected bytes=%u",
-                        Filename, (unsigned int)OsStatus, (unsigned int)FILE_PRI_HDR_BYTES);
 
-   } /* End invalid cFE header read */
+      for (i=0; (i + sizeof(CompareWord_t)) <= ByteCnt; i += sizeof(CompareWord_t))
+      {
+         memcpy(&ExpectedWord, &Expected[i], sizeof(CompareWord_t));
+         memcpy(&ActualWord, &Actual[i], sizeof(CompareWord_t));
+         if ((ExpectedWord ^ ActualWord) != 0)
+         {
+            for (j=i; j < (i + sizeof(CompareWord_t)); j++)
+            {
+               if (Expected[j] != Actual[j])
+               {
+                  AddDiffByte(Offset + j, Expected[j], Actual[j]);
+               }
+            }
+         }
+      } /* End word loop */
    
-   return RetStatus;
+      for (; i < ByteCnt; i++)
+      {
+         if (Expected[i] != Actual[i])
+         {
+            AddDiffByte(Offset + i, Expected[i], Actual[i]);
+         }
+      }
+
+   } /* End if block differs */
    
-}/* End CreateDumpFile() */
+} /* End CompareBlock() */
 
 
 /******************************************************************************
-** Function: DumpMemToFile
+** Function: CompareMemWithFile
 **
 ** Notes:
-**   1. Assumes file position is at the start of the dump data.
+**   1. Assumes the file is positioned at the start of the file data.
+**   2. Direct access memory is compared in place. Other memory is read into
+**      the compare buffer with the file's memory size.
+**   3. The file's CRC is computed on each block as it is compared and the
+**      MEM_PIPE helper task reads the next block while the current block is
+**      compared.
 **
 */
-static bool DumpMemToFile(MEM_MGR_CpuAddr_Atom_t SrcCpuAddr, osal_id_t FileHandle,
-                          const char *Filename, MEM_MGR_MemSize_Enum_t MemSize, uint32 ByteCnt)
+static bool CompareMemWithFile(const char *Filename, osal_id_t FileHandle, const MEM_MGR_SecFileHdr_t *SecFileHdr,
+                               MEM_MGR_CpuAddr_Atom_t CpuAddr, bool DirectAccess, uint32 *Crc)
 {
    
    bool    RetStatus = false;
-   int32   BytesRemaining = ByteCnt;
-   size_t  FileWriteBlockSize = MemFile->DumpBlockSize;
-   int32   FileWriteLength;
-   int32   PspStatus;
-   size_t  BytesProcessed = 0;
+   uint32  BytesRemaining = SecFileHdr->ByteCnt;
+   uint32  BlockSize  = MEM_PACE_BlockSize(&MemFile->Pace, MemFile->LoadBlockSize);
+   uint32  Offset     = 0;
+   uint32  CurrentCrc = 0;
+   int32   FileBytesRead;
+   uint8  *DataBuf;
+   const uint8 *MemBuf;
 
-   MemFile->TaskBlockCount = 0;
-   while (BytesRemaining != 0)
+   MEM_PACE_Start(&MemFile->Pace);
+   if (MEM_PIPE_StartRead(FileHandle, BlockSize, BytesRemaining))
    {
-      if (BytesRemaining < FileWriteBlockSize)
-      {
-         FileWriteBlockSize = BytesRemaining;
-      }
-
-      switch (MemSize)
+      RetStatus = true;
+      while ((BytesRemaining != 0) && (RetStatus == true))
       {
-         case MEM_MGR_MemSize_8:
-            RetStatus = MEM_SIZE8_ReadBlock((uint8*)SrcCpuAddr, (uint8*)MemFile->IoBuf, FileWriteBlockSize);
-            break;
-         case MEM_MGR_MemSize_16:
-            RetStatus = MEM_SIZE16_ReadBlock((uint16*)SrcCpuAddr, (uint16*)MemFile->IoBuf, FileWriteBlockSize/2);
-            break;
-         case MEM_MGR_MemSize_32:
-            RetStatus = MEM_SIZE32_ReadBlock((uint32*)SrcCpuAddr, (uint32*)MemFile->IoBuf, FileWriteBlockSize/4);
-            break;
-         case MEM_MGR_MemSize_VOID:
-            PspStatus = CFE_PSP_MemCpy((void*)MemFile->IoBuf, (void*)SrcCpuAddr, FileWriteBlockSize);
-            RetStatus = (PspStatus == CFE_PSP_SUCCESS);
-            //TODO: Event
-            break;
-         default:
-            //TODO: Event
-            break;
-      } /* End mem size switch */
+         if (BytesRemaining < BlockSize)
+         {
+            BlockSize = BytesRemaining;
+         }
 
-      if (RetStatus == true)
-      {
-         if ((FileWriteLength = OS_write(FileHandle, MemFile->IoBuf, FileWriteBlockSize)) == FileWriteBlockSize)
+         FileBytesRead = MEM_PIPE_GetReadBuf(&DataBuf);
+         if (FileBytesRead == BlockSize)
          {
-            BytesProcessed += FileWriteBlockSize;
-            BytesRemaining -= FileWriteBlockSize;
+            if (DirectAccess)
+            {
+               MemBuf = (const uint8 *)(CpuAddr + Offset);
+            }
+            else
+            {
+               // Event sent by MEM_SIZEx_ReadBlock()
+               MemBuf = (const uint8 *)MemFile->IoBuf;
+               RetStatus = MEMORY_ReadBlock(MemFile->IoBuf, CpuAddr + Offset, SecFileHdr->MemSize, BlockSize, false);
+            }
+            
+            if (RetStatus == true)
+            {
+               CurrentCrc = MEM_CRC_Calculate(DataBuf, BlockSize, CurrentCrc, SecFileHdr->CrcType);
+               CompareBlock(DataBuf, MemBuf, Offset, BlockSize);
+               
+               Offset         += BlockSize;
+               BytesRemaining -= BlockSize;
+            }
+            MEM_PIPE_ReleaseReadBuf();
 
             if (BytesRemaining != 0)
             {
-               CHILDMGR_PauseTask(&MemFile->TaskBlockCount, MemFile->TaskBlockLimit, MemFile->TaskBlockDelay, MemFile->TaskPerfId);
+               MEM_PACE_Pause(&MemFile->Pace, BlockSize);
             }
-         } /* Valid memory write */            
+         }
+         else
+         {
+            CFE_EVS_SendEvent(MEM_FILE_COMPARE_MEM_EID, CFE_EVS_EventType_ERROR,
+                              "Error reading file %s compare data. Status=%d, Expected bytes=%u",
+                              Filename, (int)FileBytesRead, (unsigned int)BlockSize);               
+            RetStatus = false;
+         }
+      } /* End while bytes */
+      
+      MEM_PIPE_Stop();
+      FlushDiffRun();
+      *Crc = CurrentCrc;
+      
+   } /* End if pipe started */
+   
+   return RetStatus;
+   
+} /* End CompareMemWithFile() */
 
-      } /* End if read block */
-      else
-      {
-         // Event sent by MEM_SIZEx_ReadBlock()
-         RetStatus = false;
-         BytesRemaining = 0;
+/******************************************************************************
+** Function: CompressBlock
+**
+** Notes:
+**   1. Write a compressed block header and data to FileBuf and return the
+**      number of bytes written. The block is stored uncompressed if it
+**      doesn't get smaller.
+**
+*/
+static uint32 CompressBlock(const uint8 *RawBuf, uint32 RawLen, uint8 *FileBuf)
+{
 
-      } /* End file read */
-   } /* End while bytes */
-   if (RetStatus == true)
+   uint8  *BlockData = &FileBuf[COMP_BLOCK_HDR_BYTES];
+   uint32  DataLen;
+   MEM_MGR_CompBlockHdr_t  BlockHdr;
+
+   DataLen = MEM_LZ_Compress(&MemFile->LzArena, RawBuf, RawLen, BlockData, RawLen - 1);
+   if (DataLen == 0)
    {
-      RetStatus = (BytesProcessed == ByteCnt);
+      memcpy(BlockData, RawBuf, RawLen);
+      DataLen = RawLen;
    }
 
-   return RetStatus;
-    
-} /* End DumpMemToFile() */
+   BlockHdr.RawLen  = (uint16)RawLen;
+   BlockHdr.DataLen = (uint16)DataLen;
+   memcpy(FileBuf, &BlockHdr, COMP_BLOCK_HDR_BYTES);
+
+   return (COMP_BLOCK_HDR_BYTES + DataLen);
+
+} /* End CompressBlock() */
 
 
 /******************************************************************************
-** Function: LoadMemFromFile
+** Function: ComputeFileCrc
 **
 ** Notes:
-**   None
+**   1. Assumes the file is positioned at the start of the load data. 
+**   2. Each block is a "task block", a group of instructions that is CPU
+**      intensive and is paced by MEM_PACE to prevent CPU hogging.
+**   3. The MEM_PIPE helper task reads the next block while the CRC of the
+**      current block is computed.
 **
 */
-static bool LoadMemFromFile(MEM_MGR_CpuAddr_Atom_t DestAddr, osal_id_t FileHandle, const char *Filename,
-                            MEM_MGR_MemSize_Enum_t MemSize, uint32 ByteCnt)
+static bool ComputeFileCrc(const char *Filename, osal_id_t FileHandle, MEM_MGR_CrcType_Enum_t CrcType,
+                           uint32 ByteCnt, uint32 *Crc)
 {
    
-   bool    RetStatus = false;
-   int32   BytesRemaining = ByteCnt;
-   size_t  FileReadBlockSize  = MemFile->LoadBlockSize;
-   int32   FileReadLength;
-   int32   OsStatus;
-   int32   PspStatus;
-   size_t  BytesProcessed = 0;
-
-   MemFile->TaskBlockCount = 0;
-   // Set file pointer to the start of the load data
-   OsStatus = OS_lseek(FileHandle, FILE_HDR_BYTES, OS_SEEK_SET);
-   if (OsStatus == FILE_HDR_BYTES)
+   bool    CrcComputed  = false;
+   uint32  CurrentCrc   = 0;
+   uint32  BytesRemaining = ByteCnt;
+   uint32  FileReadBlockSize = MEM_FILE_IO_BLOCK_SIZE;
+   int32   FileBytesRead;
+   uint8  *DataBuf;
+   
+   
+   MEM_PACE_Start(&MemFile->Pace);
+   if (MEM_CRC_ValidType(CrcType))
    {
-      while (BytesRemaining != 0)
-      {
-         if (BytesRemaining < FileReadBlockSize)
-         {
-            FileReadBlockSize = BytesRemaining;
-         }
 
-         if ((FileReadLength = OS_read(FileHandle, MemFile->IoBuf, FileReadBlockSize)) == FileReadBlockSize)
+      *Crc = 0;   
+      if (MEM_PIPE_StartRead(FileHandle, FileReadBlockSize, ByteCnt))
+      {
+         while (BytesRemaining != 0)
          {
+            if (BytesRemaining < FileReadBlockSize)
+            {
+               FileReadBlockSize = BytesRemaining;
+            }
             
-            switch (MemSize)
-            {
-               case MEM_MGR_MemSize_8:
-                  RetStatus = MEM_SIZE8_WriteBlock((uint8*)DestAddr, (uint8*)MemFile->IoBuf, FileReadBlockSize);
-                  break;
-               case MEM_MGR_MemSize_16:
-                  RetStatus = MEM_SIZE16_WriteBlock((uint16*)DestAddr, (uint16*)MemFile->IoBuf, FileReadBlockSize/2);
-                  break;
-               case MEM_MGR_MemSize_32:
-                  RetStatus = MEM_SIZE32_WriteBlock((uint32*)DestAddr, (uint32*)MemFile->IoBuf, FileReadBlockSize/4);
-                  break;
-               case MEM_MGR_MemSize_VOID:
-                  PspStatus = CFE_PSP_MemCpy((void*)DestAddr, MemFile->IoBuf, FileReadBlockSize);
-                  RetStatus = (PspStatus == CFE_PSP_SUCCESS);
-                  //TODO: Event
-                  break;
-               default:
-                  //TODO: Event
-                  break;
-            } /* End mem size switch */
-
-            if (RetStatus == true)
+            FileBytesRead = MEM_PIPE_GetReadBuf(&DataBuf);
+            if (FileBytesRead == FileReadBlockSize)
             {
-                BytesProcessed += FileReadBlockSize;
-                BytesRemaining -= FileReadBlockSize;
-
-                if (BytesRemaining != 0)
-                {
-                  CHILDMGR_PauseTask(&MemFile->TaskBlockCount, MemFile->TaskBlockLimit, MemFile->TaskBlockDelay, MemFile->TaskPerfId);
-                }
-            } /* Valid memory write */            
-         } /* End file read */
-         else
+               CurrentCrc = MEM_CRC_Calculate(DataBuf, FileBytesRead, CurrentCrc, CrcType);
+               MEM_PIPE_ReleaseReadBuf();
+               
+               BytesRemaining -= FileBytesRead;
+         
+               MEM_PACE_Pause(&MemFile->Pace, FileBytesRead);
+            }
+            else
+            {
+               CFE_EVS_SendEvent(MEM_FILE_COMPUTE_FILE_CRC_EID, CFE_EVS_EventType_ERROR,
+                                 "File read error %d while computing CRC for file %s",
+                                 (int)FileBytesRead, Filename);
+               break;
+            }
+         } /* End while bytes */
+         
+         if (MEM_PIPE_Stop() && (BytesRemaining == 0))
          {
-            // Event sent by MEM_SIZEx_WriteBlock()            
-            RetStatus = false;
-            BytesRemaining = 0;
+            *Crc = CurrentCrc;
+            CrcComputed = true;
+         }
+      } /* End if pipe started */
+   }
+   else
+   {
+            CFE_EVS_SendEvent(MEM_FILE_COMPUTE_FILE_CRC_EID, CFE_EVS_EventType_ERROR,
+                              "Invalid CRC type %d. See mem_mgr.xml CrcType for valid types.",
+                              CrcType);      
+   }
+   
+   return CrcComputed;
+   
+} /* End ComputeCrc() */
 
-         } /* End file read */
-      } /* End while bytes */
-      if (RetStatus == true)
+
+/******************************************************************************
+** Function: CreateDiffFile
+**
+** Notes:
+**   1. Create the diff file and write its headers. The diff file header is
+**      rewritten with the mismatch and run counts when the compare completes.
+**
+*/
+static bool CreateDiffFile(const char *DiffFilename, const MEM_MGR_SecFileHdr_t *SecFileHdr,
+                           MEM_MGR_CpuAddr_Atom_t StartAddr)
+{
+
+   bool  RetStatus = false;
+   int32 OsStatus; 
+   CFE_FS_Header_t  CfeFileHeader;
+   MEM_FILE_Diff_t *Diff = &MemFile->Diff;
+   
+   OsStatus = OS_OpenCreate(&Diff->FileHandle, DiffFilename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE);
+   if (OsStatus == OS_SUCCESS)
+   {
+      Diff->FileOpen = true;
+      
+      CFE_FS_InitHeader(&CfeFileHeader, DIFF_FILE_CFE_HDR_DESCR,
+                        INITBL_GetIntConfig(MemFile->IniTbl, CFG_MEM_FILE_CFE_HDR_SUBTYPE));
+   
+      OsStatus = CFE_FS_WriteHeader(Diff->FileHandle, &CfeFileHeader);
+      if (OsStatus == FILE_PRI_HDR_BYTES)
       {
-         RetStatus = (BytesProcessed == ByteCnt);
+         RetStatus = WriteDiffFileHdr(DiffFilename, SecFileHdr, StartAddr);
       }
-   } /* End valid lseek */
+      else
+      {
+         CFE_EVS_SendEvent(MEM_FILE_COMPARE_MEM_EID, CFE_EVS_EventType_ERROR,
+                           "Error writing diff file %s cFE header. Status=0x%08X, Expected bytes=%u",
+                           DiffFilename, (unsigned int)OsStatus, (unsigned int)FILE_PRI_HDR_BYTES);
+      }
+   }
    else
    {
-      CFE_EVS_SendEvent(MEM_FILE_LOAD_MEM_FROM_FILE_EID, CFE_EVS_EventType_ERROR,
-                        "Error reading file %s MEM_MGR header. Status=0x%08X, Expected bytes=%u",
-                        Filename, (unsigned int)OsStatus, (unsigned int)FILE_SEC_HDR_BYTES);               
+      CFE_EVS_SendEvent(MEM_FILE_COMPARE_MEM_EID, CFE_EVS_EventType_ERROR,
+                        "Error creating diff file %s, status = 0x%08X",
+                        DiffFilename, (unsigned int)OsStatus);
    }
-
+   
    return RetStatus;
-    
-} /* End LoadMemFromFile() */
-
+   
+} /* End CreateDiffFile() */
 
 /******************************************************************************
-** Function: ProcessLoadFile
+** Function: CreateDumpFile
 **
 ** Notes:
 **   1. Perform all file verification before calling the function to perform
-**      the memory load
+**      the memory dump
+**   2. The secondary header is written with a zero CRC, the data CRC is
+**      computed while the memory is dumped and then the secondary header is
+**      rewritten with the CRC. This makes every dump file a valid load file
+**      without a second pass over the data.
+**   3. Delta dumps write the DeltaFileHdr, changed blocks and index after
+**      the secondary header, see DumpDeltaToFile().
 **
 */
-static bool ProcessLoadFile(const char *Filename, osal_id_t FileHandle,
-                            MEM_MGR_SecFileHdr_t *SecFileHdr, MEM_MGR_CpuAddr_Atom_t *CpuAddr)
+static bool CreateDumpFile(const char *Filename, osal_id_t FileHandle,
+                           MEM_MGR_SecFileHdr_t *SecFileHdr, MEM_MGR_CpuAddr_Atom_t SrcCpuAddr,
+                           bool DirectAccess)
 {
 
    bool  RetStatus = false;
+   bool  DumpStatus;
    int32 OsStatus; 
-   CFE_FS_Header_t         CfeFileHeader;
-   MEMORY_VerifiedMemory_t VerifiedMemory;
+   CFE_FS_Header_t  CfeFileHeader;
 
-         
-   // Read and validate file headers
-   OsStatus = CFE_FS_ReadHeader(&CfeFileHeader, FileHandle);
+   CFE_FS_InitHeader(&CfeFileHeader, INITBL_GetStrConfig(MemFile->IniTbl, CFG_MEM_FILE_CFE_HDR_DESCR),
+                     INITBL_GetIntConfig(MemFile->IniTbl, CFG_MEM_FILE_CFE_HDR_SUBTYPE));
+   
+   OsStatus = CFE_FS_WriteHeader(FileHandle, &CfeFileHeader);
    if (OsStatus == FILE_PRI_HDR_BYTES)
    {
-      OsStatus = OS_read(FileHandle, SecFileHdr, FILE_SEC_HDR_BYTES);
+      SecFileHdr->Crc = 0;
+      OsStatus = OS_write(FileHandle, SecFileHdr, FILE_SEC_HDR_BYTES);
       if (OsStatus == FILE_SEC_HDR_BYTES)
       {
-         if (ValidLoadFile(Filename, FileHandle, SecFileHdr))
+         if (SecFileHdr->DumpType == MEM_MGR_DumpType_DELTA)
          {
-            if (MEMORY_VerifyAddr(SecFileHdr->SymbolAddr, SecFileHdr->MemType, SecFileHdr->MemSize,
-                                  SecFileHdr->ByteCnt, &VerifiedMemory))
-            {
-               RetStatus = LoadMemFromFile(VerifiedMemory.CpuAddr, FileHandle, Filename,
-                                           SecFileHdr->MemSize, SecFileHdr->ByteCnt);
-            }
+            DumpStatus = DumpDeltaToFile(SrcCpuAddr, FileHandle, Filename, SecFileHdr->MemSize, DirectAccess,
+                                         SecFileHdr->ByteCnt, SecFileHdr->CrcType, &SecFileHdr->Crc);
+         }
+         else
+         {
+            DumpStatus = DumpMemToFile(SrcCpuAddr, FileHandle, Filename, SecFileHdr->MemSize, DirectAccess,
+                                       SecFileHdr->ByteCnt, SecFileHdr->CrcType, SecFileHdr->Compression,
+                                       &SecFileHdr->Crc);
+         }
+         if (DumpStatus == true)
+         {
+            RetStatus = WriteSecFileHdrCrc(Filename, FileHandle, SecFileHdr);
          }
       }           
       else
       {
-         CFE_EVS_SendEvent(MEM_FILE_PROCESS_LOAD_FILE_EID, CFE_EVS_EventType_ERROR,
-                           "Error reading file %s MEM_MGR header. Status=0x%08X, Expected bytes=%u",
+         CFE_EVS_SendEvent(MEM_FILE_CREATE_DUMP_FILE_EID, CFE_EVS_EventType_ERROR,
+                           "Error writing file %s MEM_MGR header. Status=0x%08X, Expected bytes=%u",
                            Filename, (unsigned int)OsStatus, (unsigned int)FILE_SEC_HDR_BYTES);
 
       } /* end OS_read if */
@@ -651,71 +1222,2198 @@ static bool ProcessLoadFile(const char *Filename, osal_id_t FileHandle,
    } /* End valid cFE header read */
    else
    {
-      CFE_EVS_SendEvent(MEM_FILE_PROCESS_LOAD_FILE_EID, CFE_EVS_EventType_ERROR,
-                        "Error reading file %s cFE header. Status=0x%08X, Expected bytes=%u",
+      CFE_EVS_SendEvent(MEM_FILE_CREATE_DUMP_FILE_EID, CFE_EVS_EventType_ERROR,
+                        "Error writing file %s cFE header. Status=0x%08X, Expected bytes=%u",
                         Filename, (unsigned int)OsStatus, (unsigned int)FILE_PRI_HDR_BYTES);
 
    } /* End invalid cFE header read */
    
    return RetStatus;
    
-}/* End ProcessLoadFile() */
+}/* End CreateDumpFile() */
 
 
 /******************************************************************************
-** Function: ValidLoadFile
+** Function: CreateRegionsFile
 **
 ** Notes:
-**   1. Load file valid
+**   1. The regions in MemFile->Patch must have been verified for read access.
+**   2. The file is written in the patch file format, see mem_mgr.xml
+**      PatchFileHdr. The index is written first and then every region's
+**      data is streamed through one MEM_PIPE transfer so the file is
+**      written with a single pass over memory.
+**   3. Like CreateDumpFile(), the header is written with a zero CRC and
+**      rewritten with the CRC of the index and data after the data has been
+**      written.
 **
 */
-static bool ValidLoadFile(const char *Filename, osal_id_t FileHandle, const MEM_MGR_SecFileHdr_t *SecFileHdr)
+static bool CreateRegionsFile(const char *Filename, osal_id_t FileHandle, MEM_MGR_PatchFileHdr_t *PatchFileHdr)
 {
-   bool       RetStatus = false;
-   int32      OsStatus;
-   size_t     SizeFromHdr;
-   int32      SizeFromOs;
-   os_fstat_t FileStats;
-   uint32     FileCrc;
-   
-   memset(&FileStats, 0, sizeof(FileStats));
 
-   OsStatus = OS_stat(Filename, &FileStats);
-   if (OsStatus == OS_SUCCESS)
+   bool    RetStatus = false;
+   bool    PipeStatus;
+   int32   OsStatus; 
+   uint16  i;
+   uint32  IndexBytes = PatchFileHdr->RecordCnt * PATCH_RECORD_BYTES;
+   uint32  Crc;
+   CFE_FS_Header_t   CfeFileHeader;
+   MEM_FILE_Patch_t *Patch = &MemFile->Patch;
+
+   CFE_FS_InitHeader(&CfeFileHeader, REGIONS_FILE_CFE_HDR_DESCR,
+                     INITBL_GetIntConfig(MemFile->IniTbl, CFG_MEM_FILE_CFE_HDR_SUBTYPE));
+   
+   OsStatus = CFE_FS_WriteHeader(FileHandle, &CfeFileHeader);
+   if (OsStatus == FILE_PRI_HDR_BYTES)
    {
-      SizeFromOs  = OS_FILESTAT_SIZE(FileStats);
-      SizeFromHdr = SecFileHdr->ByteCnt + FILE_HDR_BYTES;
-      if (SizeFromOs == SizeFromHdr)
+      PatchFileHdr->Crc = 0;
+      OsStatus = OS_write(FileHandle, PatchFileHdr, PATCH_FILE_HDR_BYTES);
+      if (OsStatus == PATCH_FILE_HDR_BYTES)
+      {
+         OsStatus = OS_write(FileHandle, Patch->Record, IndexBytes);
+      }
+      if (OsStatus == IndexBytes)
       {
-         if (ComputeFileCrc(Filename, FileHandle, SecFileHdr->CrcType, &FileCrc))
+
+         Crc = MEM_CRC_Calculate(Patch->Record, IndexBytes, 0, PatchFileHdr->CrcType);
+
+         MemFile->DumpStatus.FileDataLen = 0;
+         MEM_PACE_Start(&MemFile->Pace);
+         if (MEM_PIPE_StartWrite(FileHandle))
          {
-            if (FileCrc == SecFileHdr->Crc)
+            RetStatus = true;
+            for (i=0; (i < Patch->RecordCnt) && (RetStatus == true); i++)
+            {
+               // Events sent by DumpMemToPipe()
+               RetStatus = DumpMemToPipe(Patch->Memory[i].CpuAddr, Patch->Record[i].MemSize, Patch->Memory[i].DirectAccess,
+                                         Patch->Record[i].ByteCnt, PatchFileHdr->CrcType, MEM_MGR_Compression_NONE, &Crc);
+            }
+
+            PipeStatus = MEM_PIPE_Stop();
+            if (RetStatus == true)
+            {
+               if (PipeStatus == true)
+               {
+                  PatchFileHdr->Crc = Crc;
+                  OsStatus = OS_lseek(FileHandle, FILE_PRI_HDR_BYTES, OS_SEEK_SET);
+                  if (OsStatus == FILE_PRI_HDR_BYTES)
+                  {
+                     OsStatus = OS_write(FileHandle, PatchFileHdr, PATCH_FILE_HDR_BYTES);
+                  }
+                  if (OsStatus != PATCH_FILE_HDR_BYTES)
+                  {
+                     CFE_EVS_SendEvent(MEM_FILE_CREATE_REGIONS_FILE_EID, CFE_EVS_EventType_ERROR,
+                                       "Error writing CRC 0x%08X to file %s patch header. Status=0x%08X",
+                                       (unsigned int)Crc, Filename, (unsigned int)OsStatus);
+                     RetStatus = false;
+                  }
+               }
+               else
+               {
+                  CFE_EVS_SendEvent(MEM_FILE_CREATE_REGIONS_FILE_EID, CFE_EVS_EventType_ERROR,
+                                    "Error writing region data to file %s", Filename);
+                  RetStatus = false;
+               }
+            }
+            else
+            {
+               CFE_EVS_SendEvent(MEM_FILE_CREATE_REGIONS_FILE_EID, CFE_EVS_EventType_ERROR,
+                                 "Multi-region dump to file %s stopped at region %u of %u",
+                                 Filename, (unsigned int)i, Patch->RecordCnt);
+            }
+         } /* End if pipe started */
+
+      } /* End if wrote patch header and index */
+      else
+      {
+         CFE_EVS_SendEvent(MEM_FILE_CREATE_REGIONS_FILE_EID, CFE_EVS_EventType_ERROR,
+                           "Error writing file %s patch header and index. Status=0x%08X",
+                           Filename, (unsigned int)OsStatus);
+      }
+   } /* End if wrote cFE header */
+   else
+   {
+      CFE_EVS_SendEvent(MEM_FILE_CREATE_REGIONS_FILE_EID, CFE_EVS_EventType_ERROR,
+                        "Error writing file %s cFE header. Status=0x%08X, Expected bytes=%u",
+                        Filename, (unsigned int)OsStatus, (unsigned int)FILE_PRI_HDR_BYTES);
+   }
+   
+   return RetStatus;
+   
+} /* End CreateRegionsFile() */
+
+
+/******************************************************************************
+** Function: DecompressLoadFile
+**
+** Notes:
+**   1. Decompress a compressed load file and return the CRC of the
+**      decompressed data. The file data is read once using MEM_PIPE.
+**   2. If StagingBuf isn't NULL the file is decompressed into it. Otherwise
+**      each block is decompressed into IoBuf and, if VerifiedMemory isn't
+**      NULL, written to memory. The caller must verify the CRC before
+**      memory is written.
+**   3. The file must decompress to exactly the header's ByteCnt with no
+**      extra file data.
+**   4. Blocks that aren't a whole number of 16/32-bit memory elements are
+**      rejected so a file with a valid CRC can't drop bytes or misalign the
+**      remaining writes. The CRC pass always reads every block so memory is
+**      never written from an invalid file.
+**
+*/
+static bool DecompressLoadFile(const char *Filename, osal_id_t FileHandle, const MEM_MGR_SecFileHdr_t *SecFileHdr,
+                               uint8 *StagingBuf, const MEMORY_VerifiedMemory_t *VerifiedMemory, uint32 *Crc)
+{
+
+   bool    RetStatus = false;
+   int32   FileLen;
+   int32   OsStatus;
+   uint32  BytesRemaining = SecFileHdr->ByteCnt;
+   uint32  MaxRawLen;
+   uint32  RawLen;
+   uint32  ElementLen = 1;
+   uint32  CurrentCrc = 0;
+   uint8  *RawBuf = (uint8 *)MemFile->IoBuf;
+   MEM_MGR_CpuAddr_Atom_t DestAddr = 0;
+   MEM_FILE_CompReader_t *Reader = &MemFile->CompReader;
+
+   if (VerifiedMemory != NULL)
+   {
+      DestAddr = VerifiedMemory->CpuAddr;
+   }
+   if ((SecFileHdr->MemSize == MEM_MGR_MemSize_16) || (SecFileHdr->MemSize == MEM_MGR_MemSize_32))
+   {
+      ElementLen = SecFileHdr->MemSize;  // MemSize value is the number of bytes
+   }
+   
+   MEM_PACE_Start(&MemFile->Pace);
+   FileLen  = OS_lseek(FileHandle, 0, OS_SEEK_END);
+   OsStatus = OS_lseek(FileHandle, FILE_HDR_BYTES, OS_SEEK_SET);
+   if ((FileLen > (int32)FILE_HDR_BYTES) && (OsStatus == FILE_HDR_BYTES))
+   {
+      Reader->PipeBuf    = NULL;
+      Reader->PipeBufLen = 0;
+      Reader->PipeBufPos = 0;
+      Reader->FileBytesRemaining = FileLen - FILE_HDR_BYTES;
+      
+      if (MEM_PIPE_StartRead(FileHandle, MEM_FILE_IO_BLOCK_SIZE, Reader->FileBytesRemaining))
+      {
+         RetStatus = true;
+         while ((BytesRemaining != 0) && (RetStatus == true))
+         {
+            MaxRawLen = (BytesRemaining < MEM_FILE_IO_BLOCK_SIZE) ? BytesRemaining : MEM_FILE_IO_BLOCK_SIZE;
+            if (StagingBuf != NULL)
+            {
+               RawBuf = &StagingBuf[SecFileHdr->ByteCnt - BytesRemaining];
+            }
+
+            // Events sent by ReadCompBlock() and MEM_SIZEx_WriteBlock()
+            RetStatus = ReadCompBlock(Filename, RawBuf, MaxRawLen, ElementLen, &RawLen);
+            if (RetStatus == true)
+            {
+               CurrentCrc = MEM_CRC_Calculate(RawBuf, RawLen, CurrentCrc, SecFileHdr->CrcType);
+               if (VerifiedMemory != NULL)
+               {
+                  RetStatus = MEMORY_WriteBlock(DestAddr, SecFileHdr->MemSize, RawBuf, RawLen,
+                                                VerifiedMemory->DirectAccess);
+                  DestAddr += RawLen;
+               }
+               BytesRemaining -= RawLen;
+
+               MEM_PACE_Pause(&MemFile->Pace, RawLen);
+            }
+         } /* End while bytes */
+         
+         if (Reader->PipeBuf != NULL)
+         {
+            MEM_PIPE_ReleaseReadBuf();
+         }
+         MEM_PIPE_Stop();
+         
+         if (RetStatus == true)
+         {
+            if ((Reader->FileBytesRemaining == 0) && (Reader->PipeBufPos == Reader->PipeBufLen))
+            {
+               *Crc = CurrentCrc;
+            }
+            else
+            {
+               CFE_EVS_SendEvent(MEM_FILE_DECOMPRESS_FILE_EID, CFE_EVS_EventType_ERROR,
+                                 "Compressed load file %s has data after its %u decompressed bytes",
+                                 Filename, (unsigned int)SecFileHdr->ByteCnt);
+               RetStatus = false;
+            }
+         }
+      } /* End if pipe started */
+   }
+   else
+   {
+      CFE_EVS_SendEvent(MEM_FILE_DECOMPRESS_FILE_EID, CFE_EVS_EventType_ERROR,
+                        "Error positioning compressed load file %s. File length=%d, Seek status=%d",
+                        Filename, (int)FileLen, (int)OsStatus);
+   }
+   
+   return RetStatus;
+   
+} /* End DecompressLoadFile() */
+
+
+/******************************************************************************
+** Function: DeltaBlockSize
+**
+** Notes:
+**   1. Return the delta block size of a ByteCnt byte region or zero if the
+**      region is too large for delta dumps. See app_cfg.h.
+**
+*/
+static uint32 DeltaBlockSize(uint32 ByteCnt)
+{
+
+   uint32 BlockSize = MEM_FILE_DELTA_MIN_BLOCK_SIZE;
+   
+   while ((BlockSize <= MEM_FILE_IO_BLOCK_SIZE) &&
+          (((ByteCnt / BlockSize) + (((ByteCnt % BlockSize) != 0) ? 1 : 0)) > MEM_FILE_DELTA_MAX_BLOCKS))
+   {
+      BlockSize *= 2;
+   }
+   
+   return (BlockSize <= MEM_FILE_IO_BLOCK_SIZE) ? BlockSize : 0;
+   
+} /* End DeltaBlockSize() */
+
+
+/******************************************************************************
+** Function: DumpDeltaToFile
+**
+** Notes:
+**   1. Assumes file position is at the end of the secondary header.
+**   2. Each block is read into IoBuf and its CRC is compared with the same
+**      block of the region's last dump. Changed blocks are copied to a
+**      MEM_PIPE buffer and their block numbers are saved in the index that
+**      is written after the block data. Memory is only read once so the
+**      block data, index and image CRC are consistent even if memory
+**      changes during the dump.
+**   3. The DeltaFileHdr is written with zero counts and rewritten after the
+**      index has been written.
+**   4. Every block is written if the region doesn't have a recorded dump.
+**
+*/
+static bool DumpDeltaToFile(MEM_MGR_CpuAddr_Atom_t SrcCpuAddr, osal_id_t FileHandle,
+                            const char *Filename, MEM_MGR_MemSize_Enum_t MemSize, bool DirectAccess,
+                            uint32 ByteCnt, MEM_MGR_CrcType_Enum_t CrcType, uint32 *Crc)
+{
+   
+   bool    RetStatus = false;
+   bool    PipeStatus;
+   int32   OsStatus;
+   uint32  Block;
+   uint32  BlockLen;
+   uint32  IndexLen;
+   uint32  IndexPos;
+   uint32  CurrentCrc = 0;
+   uint8  *RawBuf = (uint8 *)MemFile->IoBuf;
+   uint8  *DataBuf;
+   MEM_FILE_Delta_t *Delta = &MemFile->Delta;
+   const MEM_FILE_DeltaRegion_t *Base = FindDeltaRegion(SrcCpuAddr, ByteCnt);
+   MEM_MGR_DeltaFileHdr_t DeltaFileHdr;
+
+   memset(&DeltaFileHdr, 0, sizeof(MEM_MGR_DeltaFileHdr_t));
+   
+   OsStatus = OS_write(FileHandle, &DeltaFileHdr, DELTA_FILE_HDR_BYTES);
+   if (OsStatus == DELTA_FILE_HDR_BYTES)
+   {
+
+      DeltaFileHdr.BaseCrc   = (Base != NULL) ? Base->ImageCrc : 0;
+      DeltaFileHdr.BlockSize = Delta->BlockSize;
+      DeltaFileHdr.BlockCnt  = (ByteCnt / Delta->BlockSize) + (((ByteCnt % Delta->BlockSize) != 0) ? 1 : 0);
+
+      MemFile->DumpStatus.FileDataLen = 0;
+      MEM_PACE_Start(&MemFile->Pace);
+      if (MEM_PIPE_StartWrite(FileHandle))
+      {
+         RetStatus = true;
+         for (Block=0; (Block < DeltaFileHdr.BlockCnt) && (RetStatus == true); Block++)
+         {
+            BlockLen = ByteCnt - Block * Delta->BlockSize;
+            if (BlockLen > Delta->BlockSize)
+            {
+               BlockLen = Delta->BlockSize;
+            }
+         
+            // Event sent by MEM_SIZEx_ReadBlock()
+            RetStatus = MEMORY_ReadBlock(RawBuf, SrcCpuAddr, MemSize, BlockLen, DirectAccess);
+            if (RetStatus == true)
+            {
+               CurrentCrc = MEM_CRC_Calculate(RawBuf, BlockLen, CurrentCrc, CrcType);
+               Delta->BlockCrc[Block] = MEM_CRC_Calculate(RawBuf, BlockLen, 0, CrcType);
+            
+               if ((Base == NULL) || (Base->BlockCrc[Block] != Delta->BlockCrc[Block]))
+               {
+                  Delta->ChangedBlock[DeltaFileHdr.ChangedCnt++] = Block;
+                  MemFile->DumpStatus.FileDataLen += BlockLen;
+
+                  DataBuf = MEM_PIPE_GetWriteBuf();
+                  memcpy(DataBuf, RawBuf, BlockLen);
+                  // Write errors reported by MEM_PIPE
+                  RetStatus = MEM_PIPE_PutWriteBuf(BlockLen);
+               }
+            
+               SrcCpuAddr += BlockLen;
+               MEM_PACE_Pause(&MemFile->Pace, BlockLen);
+            }
+         } /* End block loop */
+      
+         IndexLen = DeltaFileHdr.ChangedCnt * DELTA_INDEX_ENTRY_BYTES;
+         for (IndexPos=0; (IndexPos < IndexLen) && (RetStatus == true); IndexPos += BlockLen)
+         {
+            BlockLen = IndexLen - IndexPos;
+            if (BlockLen > MEM_FILE_IO_BLOCK_SIZE)
+            {
+               BlockLen = MEM_FILE_IO_BLOCK_SIZE;
+            }
+            DataBuf = MEM_PIPE_GetWriteBuf();
+            memcpy(DataBuf, &((uint8 *)Delta->ChangedBlock)[IndexPos], BlockLen);
+            RetStatus = MEM_PIPE_PutWriteBuf(BlockLen);
+         }
+      
+         PipeStatus = MEM_PIPE_Stop();
+         if (RetStatus == true)
+         {
+            RetStatus = false;
+            if (PipeStatus == true)
+            {
+               OsStatus = OS_lseek(FileHandle, FILE_HDR_BYTES, OS_SEEK_SET);
+               if (OsStatus == FILE_HDR_BYTES)
+               {
+                  OsStatus = OS_write(FileHandle, &DeltaFileHdr, DELTA_FILE_HDR_BYTES);
+                  RetStatus = (OsStatus == DELTA_FILE_HDR_BYTES);
+               }
+            }
+            if (RetStatus == true)
+            {
+               MemFile->DumpStatus.ChangedCnt = DeltaFileHdr.ChangedCnt;
+               *Crc = CurrentCrc;
+            }
+            else
+            {
+               CFE_EVS_SendEvent(MEM_FILE_DUMP_DELTA_TO_FILE_EID, CFE_EVS_EventType_ERROR,
+                                 "Error writing delta dump data to file %s", Filename);
+            }
+         }
+      } /* End if pipe started */
+
+   } /* End if wrote delta header */
+   else
+   {
+      CFE_EVS_SendEvent(MEM_FILE_DUMP_DELTA_TO_FILE_EID, CFE_EVS_EventType_ERROR,
+                        "Error writing file %s delta header. Status=0x%08X, Expected bytes=%u",
+                        Filename, (unsigned int)OsStatus, (unsigned int)DELTA_FILE_HDR_BYTES);
+   }
+
+   return RetStatus;
+    
+} /* End DumpDeltaToFile() */
+
+
+/******************************************************************************
+** Function: DumpMemToFile
+**
+** Notes:
+**   1. Assumes file position is at the start of the dump data.
+**   2. Memory is read into a MEM_PIPE buffer and the MEM_PIPE helper task
+**      writes the buffer to the file while the next block is read. See
+**      DumpMemToPipe().
+**   3. MemFile->DumpStatus.FileDataLen is the number of file data bytes
+**      written.
+**
+*/
+static bool DumpMemToFile(MEM_MGR_CpuAddr_Atom_t SrcCpuAddr, osal_id_t FileHandle,
+                          const char *Filename, MEM_MGR_MemSize_Enum_t MemSize, bool DirectAccess,
+                          uint32 ByteCnt, MEM_MGR_CrcType_Enum_t CrcType,
+                          MEM_MGR_Compression_Enum_t Compression, uint32 *Crc)
+{
+   
+   bool    RetStatus = false;
+   bool    PipeStatus;
+   uint32  CurrentCrc = 0;
+
+   MemFile->DumpStatus.FileDataLen = 0;
+   MEM_PACE_Start(&MemFile->Pace);
+   if (MEM_PIPE_StartWrite(FileHandle))
+   {
+      RetStatus = DumpMemToPipe(SrcCpuAddr, MemSize, DirectAccess, ByteCnt, CrcType, Compression, &CurrentCrc);
+      
+      PipeStatus = MEM_PIPE_Stop();
+      if (RetStatus == true)
+      {
+         if (PipeStatus == true)
+         {
+            *Crc = CurrentCrc;
+         }
+         else
+         {
+            CFE_EVS_SendEvent(MEM_FILE_DUMP_MEM_TO_FILE_EID, CFE_EVS_EventType_ERROR,
+                              "Error writing dump data to file %s", Filename);
+            RetStatus = false;
+         }
+      }
+   } /* End if pipe started */
+
+   return RetStatus;
+    
+} /* End DumpMemToFile() */
+
+
+/******************************************************************************
+** Function: DumpMemToPipe
+**
+** Notes:
+**   1. The MEM_PIPE write transfer must have been started. The caller stops
+**      the transfer so several memory regions can be written to one file.
+**   2. *Crc is updated with each block's CRC so a file's CRC can span
+**      several regions.
+**   3. Compressed dumps read memory into IoBuf and each block is compressed
+**      into the MEM_PIPE buffer. The CRC is computed on the memory contents
+**      so it can be verified after the file is decompressed. The block size
+**      is limited so an incompressible block and its header fit in a
+**      MEM_PIPE buffer.
+**   4. The number of file data bytes written is added to
+**      MemFile->DumpStatus.FileDataLen.
+**   5. If MemFile->Delta.BlockSize isn't zero the delta block CRCs are
+**      computed from the same memory reads so a delta dump can follow a full
+**      dump.
+**
+*/
+static bool DumpMemToPipe(MEM_MGR_CpuAddr_Atom_t SrcCpuAddr, MEM_MGR_MemSize_Enum_t MemSize, bool DirectAccess,
+                          uint32 ByteCnt, MEM_MGR_CrcType_Enum_t CrcType,
+                          MEM_MGR_Compression_Enum_t Compression, uint32 *Crc)
+{
+   
+   bool    RetStatus = false;
+   uint32  BytesRemaining = ByteCnt;
+   uint32  FileWriteBlockSize = MEM_PACE_BlockSize(&MemFile->Pace, MemFile->DumpBlockSize);
+   uint32  FileDataLen;
+   size_t  BytesProcessed = 0;
+   uint8  *DataBuf;
+   uint8  *RawBuf;
+
+   if ((Compression != MEM_MGR_Compression_NONE) && (FileWriteBlockSize > COMP_BLOCK_MAX_RAW_LEN))
+   {
+      FileWriteBlockSize = COMP_BLOCK_MAX_RAW_LEN;
+   }
+
+   while (BytesRemaining != 0)
+   {
+      if (BytesRemaining < FileWriteBlockSize)
+      {
+         FileWriteBlockSize = BytesRemaining;
+      }
+
+      DataBuf = MEM_PIPE_GetWriteBuf();
+      RawBuf  = (Compression == MEM_MGR_Compression_NONE) ? DataBuf : (uint8 *)MemFile->IoBuf;
+      
+      // Event sent by MEM_SIZEx_ReadBlock()
+      RetStatus = MEMORY_ReadBlock(RawBuf, SrcCpuAddr, MemSize, FileWriteBlockSize, DirectAccess);
+      if (RetStatus == true)
+      {
+         *Crc = MEM_CRC_Calculate(RawBuf, FileWriteBlockSize, *Crc, CrcType);
+         if (MemFile->Delta.BlockSize != 0)
+         {
+            UpdateBlockCrcs(RawBuf, BytesProcessed, FileWriteBlockSize, CrcType);
+         }
+
+         FileDataLen = FileWriteBlockSize;
+         if (Compression != MEM_MGR_Compression_NONE)
+         {
+            FileDataLen = CompressBlock(RawBuf, FileWriteBlockSize, DataBuf);
+         }
+         MemFile->DumpStatus.FileDataLen += FileDataLen;
+
+         // Write errors reported by MEM_PIPE
+         RetStatus = MEM_PIPE_PutWriteBuf(FileDataLen);
+      }
+      else
+      {
+         MEM_PIPE_PutWriteBuf(0);   // Zero length ends the helper's transfer
+      }
+      
+      if (RetStatus == true)
+      {
+         SrcCpuAddr     += FileWriteBlockSize;
+         BytesProcessed += FileWriteBlockSize;
+         BytesRemaining -= FileWriteBlockSize;
+
+         if (BytesRemaining != 0)
+         {
+            MEM_PACE_Pause(&MemFile->Pace, FileWriteBlockSize);
+         }
+      }
+      else
+      {
+         BytesRemaining = 0;
+      }
+   } /* End while bytes */
+   
+   return (RetStatus && (BytesProcessed == ByteCnt));
+    
+} /* End DumpMemToPipe() */
+
+
+/******************************************************************************
+** Function: DumpSegmentFiles
+**
+** Notes:
+**   1. SecFileHdr describes the complete region and must have a non-zero
+**      SegmentCnt. Each segment file is written by CreateDumpFile() with a
+**      header for its part of the region, so the region is read once and
+**      every segment can be loaded on its own.
+**   2. MemFile->DumpStatus.FileDataLen is set to the total of every
+**      segment's file data.
+**   3. The segments written before an error are left in place so they can
+**      still be transferred.
+**
+*/
+static bool DumpSegmentFiles(const char *Filename, const MEM_MGR_SecFileHdr_t *SecFileHdr,
+                             const MEMORY_VerifiedMemory_t *VerifiedMemory, uint32 SegmentSize)
+{
+
+   bool       RetStatus = true;
+   bool       DumpStatus;
+   int32      OsStatus;   
+   osal_id_t  FileHandle;
+   uint16     Segment;
+   uint32     SegmentOffset = 0;
+   uint32     FileDataLen = 0;
+   char       SegFilename[OS_MAX_PATH_LEN];
+   MEM_MGR_SecFileHdr_t SegFileHdr;
+   
+   for (Segment=1; (Segment <= SecFileHdr->SegmentCnt) && (RetStatus == true); Segment++)
+   {
+      
+      SegFileHdr = *SecFileHdr;
+      SegFileHdr.Segment = Segment;
+      SegFileHdr.SymbolAddr.Offset += SegmentOffset;
+      SegFileHdr.ByteCnt = SecFileHdr->ByteCnt - SegmentOffset;
+      if (SegFileHdr.ByteCnt > SegmentSize)
+      {
+         SegFileHdr.ByteCnt = SegmentSize;
+      }
+      
+      RetStatus = SegmentFilename(SegFilename, Filename, Segment);
+      if (RetStatus == true)
+      {
+         OsStatus = OS_OpenCreate(&FileHandle, SegFilename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE);
+         if (OsStatus == OS_SUCCESS)
+         {         
+            DumpStatus = CreateDumpFile(SegFilename, FileHandle, &SegFileHdr, VerifiedMemory->CpuAddr + SegmentOffset,
+                                        VerifiedMemory->DirectAccess);
+            FileDataLen += MemFile->DumpStatus.FileDataLen;
+            
+            OsStatus = OS_close(FileHandle);
+            if (OsStatus == OS_SUCCESS)
+            {
+               RetStatus = DumpStatus;
+            }
+            else
+            {
+               CFE_EVS_SendEvent(MEM_FILE_DUMP_SEGMENT_FILES_EID, CFE_EVS_EventType_ERROR,
+                                 "Error closing memory dump segment file %s, status = 0x%08X",
+                                 SegFilename, (unsigned int)OsStatus);
+               RetStatus = false;
+            }
+         }
+         else
+         {
+            CFE_EVS_SendEvent(MEM_FILE_DUMP_SEGMENT_FILES_EID, CFE_EVS_EventType_ERROR,
+                              "Error creating memory dump segment file %s, status = 0x%08X",
+                              SegFilename, (unsigned int)OsStatus);
+            RetStatus = false;
+         }
+      }
+      
+      if (RetStatus == true)
+      {
+         SegmentOffset += SegFileHdr.ByteCnt;
+      }
+      else
+      {
+         CFE_EVS_SendEvent(MEM_FILE_DUMP_SEGMENT_FILES_EID, CFE_EVS_EventType_ERROR,
+                           "Segmented dump to %s stopped at segment %u of %u, %u segments were written",
+                           Filename, (unsigned int)Segment, (unsigned int)SecFileHdr->SegmentCnt,
+                           (unsigned int)(Segment-1));
+      }
+      
+   } /* End segment loop */
+   
+   MemFile->DumpStatus.FileDataLen = FileDataLen;
+   
+   return RetStatus;
+   
+} /* End DumpSegmentFiles() */
+
+
+/******************************************************************************
+** Function: FindDeltaRegion
+**
+** Notes:
+**   1. Return the region table entry with the last dump of the region or
+**      NULL if the region doesn't have a recorded dump.
+**
+*/
+static MEM_FILE_DeltaRegion_t *FindDeltaRegion(MEM_MGR_CpuAddr_Atom_t CpuAddr, uint32 ByteCnt)
+{
+
+   uint16  i;
+   MEM_FILE_DeltaRegion_t *Region = MemFile->Delta.Region;
+   MEM_FILE_DeltaRegion_t *FoundRegion = NULL;
+   
+   for (i=0; (i < MEM_FILE_DELTA_MAX_REGIONS) && (FoundRegion == NULL); i++)
+   {
+      if (Region[i].InUse && (Region[i].CpuAddr == CpuAddr) && (Region[i].ByteCnt == ByteCnt))
+      {
+         FoundRegion = &Region[i];
+      }
+   }
+   
+   return FoundRegion;
+   
+} /* End FindDeltaRegion() */
+
+
+/******************************************************************************
+** Function: FlushDiffRun
+**
+** Notes:
+**   1. Runs are counted when there isn't a diff file. After a diff file
+**      write error the remaining runs are only counted.
+**
+*/
+static void FlushDiffRun(void)
+{
+   
+   int32  OsStatus;
+   MEM_FILE_Diff_t     *Diff = &MemFile->Diff;
+   MEM_MGR_DiffRunHdr_t RunHdr;
+   
+   if (Diff->RunLen != 0)
+   {
+
+      Diff->RunCnt++;
+   
+      if (Diff->FileOpen && !Diff->WriteError)
+      {
+         RunHdr.Offset = Diff->RunOffset;
+         RunHdr.Len    = Diff->RunLen;
+      
+         Diff->WriteError = true;
+         OsStatus = OS_write(Diff->FileHandle, &RunHdr, DIFF_RUN_HDR_BYTES);
+         if (OsStatus == DIFF_RUN_HDR_BYTES)
+         {
+            OsStatus = OS_write(Diff->FileHandle, Diff->RunExpected, Diff->RunLen);
+            if (OsStatus == Diff->RunLen)
+            {
+               OsStatus = OS_write(Diff->FileHandle, Diff->RunActual, Diff->RunLen);
+               Diff->WriteError = (OsStatus != Diff->RunLen);
+            }
+         }
+      
+         if (Diff->WriteError)
+         {
+            CFE_EVS_SendEvent(MEM_FILE_COMPARE_MEM_EID, CFE_EVS_EventType_ERROR,
+                              "Error writing diff file run %u at offset %u, status = 0x%08X",
+                              (unsigned int)Diff->RunCnt, (unsigned int)Diff->RunOffset, (unsigned int)OsStatus);
+         }
+      }
+   
+      Diff->RunLen = 0;
+
+   } /* End if run has bytes */
+   
+} /* End FlushDiffRun() */
+
+
+/******************************************************************************
+** Function: LoadDeltaBlocks
+**
+** Notes:
+**   1. ReadDeltaIndex() must have verified the delta file's index.
+**   2. If WriteMem is false the CRC of the image the load produces is
+**      computed from the changed blocks in the file and the current memory
+**      contents of the unchanged blocks. If WriteMem is true the changed
+**      blocks are written to memory and the unchanged blocks aren't read.
+**   3. The MEM_PIPE read block size is the delta block size so each read
+**      buffer holds one changed block.
+**
+*/
+static bool LoadDeltaBlocks(const char *Filename, osal_id_t FileHandle, const MEM_MGR_SecFileHdr_t *SecFileHdr,
+                            const MEM_MGR_DeltaFileHdr_t *DeltaFileHdr, const MEMORY_VerifiedMemory_t *VerifiedMemory,
+                            bool WriteMem, uint32 *Crc)
+{
+
+   bool    RetStatus = false;
+   int32   OsStatus;
+   int32   FileReadLength;
+   uint32  Block;
+   uint32  BlockLen;
+   uint32  DataLen;
+   uint32  Changed = 0;
+   uint32  CurrentCrc = 0;
+   uint8  *RawBuf = (uint8 *)MemFile->IoBuf;
+   uint8  *DataBuf;
+   MEM_MGR_CpuAddr_Atom_t BlockAddr;
+   const MEM_FILE_Delta_t *Delta = &MemFile->Delta;
+
+   DataLen = DeltaFileHdr->ChangedCnt * DeltaFileHdr->BlockSize;
+   if ((DeltaFileHdr->ChangedCnt != 0) &&
+       (Delta->ChangedBlock[DeltaFileHdr->ChangedCnt-1] == (DeltaFileHdr->BlockCnt-1)))
+   {
+      DataLen -= (DeltaFileHdr->BlockCnt * DeltaFileHdr->BlockSize) - SecFileHdr->ByteCnt;
+   }
+
+   MEM_PACE_Start(&MemFile->Pace);
+   OsStatus = OS_lseek(FileHandle, DELTA_DATA_OFFSET, OS_SEEK_SET);
+   if (OsStatus == DELTA_DATA_OFFSET)
+   {
+      // MEM_PIPE sends start error events
+      RetStatus = ((DataLen == 0) || MEM_PIPE_StartRead(FileHandle, DeltaFileHdr->BlockSize, DataLen));
+   }
+   else
+   {
+      CFE_EVS_SendEvent(MEM_FILE_LOAD_DELTA_FILE_EID, CFE_EVS_EventType_ERROR,
+                        "Error positioning delta load file %s at its block data. Status=%d",
+                        Filename, (int)OsStatus);
+   }
+   
+   if (RetStatus == true)
+   {
+
+      for (Block=0; (Block < DeltaFileHdr->BlockCnt) && (RetStatus == true); Block++)
+      {
+         BlockAddr = VerifiedMemory->CpuAddr + Block * DeltaFileHdr->BlockSize;
+         BlockLen  = SecFileHdr->ByteCnt - Block * DeltaFileHdr->BlockSize;
+         if (BlockLen > DeltaFileHdr->BlockSize)
+         {
+            BlockLen = DeltaFileHdr->BlockSize;
+         }
+      
+         if ((Changed < DeltaFileHdr->ChangedCnt) && (Delta->ChangedBlock[Changed] == Block))
+         {
+            Changed++;
+            if ((FileReadLength = MEM_PIPE_GetReadBuf(&DataBuf)) == BlockLen)
+            {
+               if (WriteMem)
+               {
+                  // Event sent by MEM_SIZEx_WriteBlock()
+                  RetStatus = MEMORY_WriteBlock(BlockAddr, SecFileHdr->MemSize, DataBuf, BlockLen,
+                                                VerifiedMemory->DirectAccess);
+               }
+               else
+               {
+                  CurrentCrc = MEM_CRC_Calculate(DataBuf, BlockLen, CurrentCrc, SecFileHdr->CrcType);
+               }
+               MEM_PIPE_ReleaseReadBuf();
+            }
+            else
+            {
+               CFE_EVS_SendEvent(MEM_FILE_LOAD_DELTA_FILE_EID, CFE_EVS_EventType_ERROR,
+                                 "Error reading file %s block %u data. Status=%d, Expected bytes=%u",
+                                 Filename, (unsigned int)Block, (int)FileReadLength, (unsigned int)BlockLen);
+               RetStatus = false;
+            }
+            MEM_PACE_Pause(&MemFile->Pace, BlockLen);
+         }
+         else if (!WriteMem)
+         {
+            // Event sent by MEM_SIZEx_ReadBlock()
+            RetStatus = MEMORY_ReadBlock(RawBuf, BlockAddr, SecFileHdr->MemSize, BlockLen, VerifiedMemory->DirectAccess);
+            if (RetStatus == true)
+            {
+               CurrentCrc = MEM_CRC_Calculate(RawBuf, BlockLen, CurrentCrc, SecFileHdr->CrcType);
+            }
+            MEM_PACE_Pause(&MemFile->Pace, BlockLen);
+         }
+      } /* End block loop */
+   
+      if (DataLen != 0)
+      {
+         MEM_PIPE_Stop();
+      }
+   
+      *Crc = CurrentCrc;
+
+   } /* End if positioned at block data */
+   
+   return RetStatus;
+   
+} /* End LoadDeltaBlocks() */
+
+
+/******************************************************************************
+** Function: LoadMemFromCompFile
+**
+** Notes:
+**   1. Decompressed data that fits in the staging buffer is decompressed
+**      once. Larger loads decompress the file twice: the first pass verifies
+**      the CRC and the second pass writes each decompressed block to memory.
+**
+*/
+static bool LoadMemFromCompFile(const char *Filename, osal_id_t FileHandle, const MEM_MGR_SecFileHdr_t *SecFileHdr,
+                                const MEMORY_VerifiedMemory_t *VerifiedMemory)
+{
+
+   bool    RetStatus = false;
+   uint32  Crc;
+   uint8  *StagingBuf = NULL;
+
+   if (SecFileHdr->ByteCnt <= MEM_MGR_LOAD_STAGING_BUF_SIZE)
+   {
+      StagingBuf = MemFile->StagingBuf;
+   }
+   
+   if (DecompressLoadFile(Filename, FileHandle, SecFileHdr, StagingBuf, NULL, &Crc))
+   {
+      if (Crc == SecFileHdr->Crc)
+      {
+         if (StagingBuf != NULL)
+         {
+            RetStatus = LoadMemFromStagingBuf(VerifiedMemory->CpuAddr, SecFileHdr->MemSize,
+                                              VerifiedMemory->DirectAccess, SecFileHdr->ByteCnt, 0);
+         }
+         else
+         {
+            RetStatus = DecompressLoadFile(Filename, FileHandle, SecFileHdr, NULL, VerifiedMemory, &Crc);
+         }
+      }
+      else
+      {
+         CFE_EVS_SendEvent(MEM_FILE_DECOMPRESS_FILE_EID, CFE_EVS_EventType_ERROR,
+                           "Load file CRC error, memory not modified: Computed=0x%08X Expected=0x%08X File: %s",
+                           (unsigned int)Crc, (unsigned int)SecFileHdr->Crc, Filename);
+      }
+   }
+   
+   return RetStatus;
+   
+} /* End LoadMemFromCompFile() */
+
+
+/******************************************************************************
+** Function: LoadMemFromDeltaFile
+**
+** Notes:
+**   1. The changed blocks are read from the file twice. The first pass
+**      computes the CRC of the image formed by the changed blocks and the
+**      current contents of the unchanged blocks. The changed blocks are only
+**      written by the second pass if the CRC matches the file's CRC so
+**      memory isn't modified unless it holds the delta's base image.
+**
+*/
+static bool LoadMemFromDeltaFile(const char *Filename, osal_id_t FileHandle, const MEM_MGR_SecFileHdr_t *SecFileHdr,
+                                 const MEMORY_VerifiedMemory_t *VerifiedMemory)
+{
+
+   bool    RetStatus = false;
+   uint32  Crc;
+   MEM_MGR_DeltaFileHdr_t DeltaFileHdr;
+
+   if (ReadDeltaIndex(Filename, FileHandle, SecFileHdr, &DeltaFileHdr))
+   {
+      if (LoadDeltaBlocks(Filename, FileHandle, SecFileHdr, &DeltaFileHdr, VerifiedMemory, false, &Crc))
+      {
+         if (Crc == SecFileHdr->Crc)
+         {
+            RetStatus = LoadDeltaBlocks(Filename, FileHandle, SecFileHdr, &DeltaFileHdr, VerifiedMemory, true, &Crc);
+         }
+         else
+         {
+            CFE_EVS_SendEvent(MEM_FILE_LOAD_DELTA_FILE_EID, CFE_EVS_EventType_ERROR,
+                              "Delta load file CRC error, memory not modified: Computed=0x%08X Expected=0x%08X. Memory doesn't hold the base image with CRC 0x%08X or the file is corrupt. File: %s",
+                              (unsigned int)Crc, (unsigned int)SecFileHdr->Crc, (unsigned int)DeltaFileHdr.BaseCrc, Filename);
+         }
+      }
+   }
+   
+   return RetStatus;
+   
+} /* End LoadMemFromDeltaFile() */
+
+
+/******************************************************************************
+** Function: LoadMemFromFile
+**
+** Notes:
+**   1. Used for load files that are too large to be staged in RAM. The
+**      file's CRC must be verified prior to calling this function.
+**   2. The MEM_PIPE helper task reads the next block from the file while
+**      the current block is written to memory.
+**
+*/
+static bool LoadMemFromFile(MEM_MGR_CpuAddr_Atom_t DestAddr, osal_id_t FileHandle, const char *Filename,
+                            MEM_MGR_MemSize_Enum_t MemSize, bool DirectAccess, uint32 ByteCnt)
+{
+   
+   bool    RetStatus = false;
+   uint32  BytesRemaining = ByteCnt;
+   uint32  FileReadBlockSize  = MEM_PACE_BlockSize(&MemFile->Pace, MemFile->LoadBlockSize);
+   int32   FileReadLength;
+   int32   OsStatus;
+   size_t  BytesProcessed = 0;
+   uint8  *DataBuf;
+
+   MEM_PACE_Start(&MemFile->Pace);
+   // Set file pointer to the start of the load data
+   OsStatus = OS_lseek(FileHandle, FILE_HDR_BYTES, OS_SEEK_SET);
+   if (OsStatus == FILE_HDR_BYTES)
+   {
+      if (MEM_PIPE_StartRead(FileHandle, FileReadBlockSize, ByteCnt))
+      {
+         while (BytesRemaining != 0)
+         {
+            if (BytesRemaining < FileReadBlockSize)
+            {
+               FileReadBlockSize = BytesRemaining;
+            }
+
+            if ((FileReadLength = MEM_PIPE_GetReadBuf(&DataBuf)) == FileReadBlockSize)
+            {
+               
+               RetStatus = MEMORY_WriteBlock(DestAddr, MemSize, DataBuf, FileReadBlockSize, DirectAccess);
+               MEM_PIPE_ReleaseReadBuf();
+
+               if (RetStatus == true)
+               {
+                   DestAddr       += FileReadBlockSize;
+                   BytesProcessed += FileReadBlockSize;
+                   BytesRemaining -= FileReadBlockSize;
+
+                   if (BytesRemaining != 0)
+                   {
+                     MEM_PACE_Pause(&MemFile->Pace, FileReadBlockSize);
+                   }
+               } /* Valid memory write */            
+               else
+               {
+                  // Event sent by MEM_SIZEx_WriteBlock()            
+                  BytesRemaining = 0;
+               }
+            } /* End file read */
+            else
+            {
+               CFE_EVS_SendEvent(MEM_FILE_LOAD_MEM_FROM_FILE_EID, CFE_EVS_EventType_ERROR,
+                                 "Error reading file %s load data. Status=%d, Expected bytes=%u",
+                                 Filename, (int)FileReadLength, (unsigned int)FileReadBlockSize);               
+               RetStatus = false;
+               BytesRemaining = 0;
+
+            } /* End file read */
+         } /* End while bytes */
+         
+         MEM_PIPE_Stop();
+         if (RetStatus == true)
+         {
+            RetStatus = (BytesProcessed == ByteCnt);
+         }
+      } /* End if pipe started */
+   } /* End valid lseek */
+   else
+   {
+      CFE_EVS_SendEvent(MEM_FILE_LOAD_MEM_FROM_FILE_EID, CFE_EVS_EventType_ERROR,
+                        "Error reading file %s MEM_MGR header. Status=0x%08X, Expected bytes=%u",
+                        Filename, (unsigned int)OsStatus, (unsigned int)FILE_SEC_HDR_BYTES);               
+   }
+
+   return RetStatus;
+    
+} /* End LoadMemFromFile() */
+
+
+/******************************************************************************
+** Function: LoadMemFromStagingBuf
+**
+** Notes:
+**   1. StageLoadFile() must have successfully verified the staged data's
+**      CRC prior to calling this function.
+**   2. StagingOffset is the staging buffer offset of the first byte to load.
+**      Staged data is packed so a 16/32-bit block that isn't aligned for its
+**      memory size is copied to IoBuf before it's written.
+**
+*/
+static bool LoadMemFromStagingBuf(MEM_MGR_CpuAddr_Atom_t DestAddr, MEM_MGR_MemSize_Enum_t MemSize, bool DirectAccess,
+                                  uint32 ByteCnt, uint32 StagingOffset)
+{
+   
+   bool    RetStatus = true;
+   uint32  BytesRemaining = ByteCnt;
+   uint32  WriteBlockSize = MEM_PACE_BlockSize(&MemFile->Pace, MemFile->LoadBlockSize);
+   uint8  *SrcPtr = &MemFile->StagingBuf[StagingOffset];
+   bool    Aligned = true;
+
+   if ((MemSize == MEM_MGR_MemSize_16) || (MemSize == MEM_MGR_MemSize_32))
+   {
+      Aligned = (((cpuaddr)SrcPtr % MemSize) == 0);  // MemSize value is the number of bytes
+   }
+
+   MEM_PACE_Start(&MemFile->Pace);
+   while ((BytesRemaining != 0) && (RetStatus == true))
+   {
+      if (BytesRemaining < WriteBlockSize)
+      {
+         WriteBlockSize = BytesRemaining;
+      }
+
+      // Event sent by MEM_SIZEx_WriteBlock() 
+      if (Aligned)
+      {
+         RetStatus = MEMORY_WriteBlock(DestAddr, MemSize, SrcPtr, WriteBlockSize, DirectAccess);
+      }
+      else
+      {
+         memcpy(MemFile->IoBuf, SrcPtr, WriteBlockSize);
+         RetStatus = MEMORY_WriteBlock(DestAddr, MemSize, MemFile->IoBuf, WriteBlockSize, DirectAccess);
+      }
+      if (RetStatus == true)
+      {
+         DestAddr       += WriteBlockSize;
+         SrcPtr         += WriteBlockSize;
+         BytesRemaining -= WriteBlockSize;
+
+         if (BytesRemaining != 0)
+         {
+            MEM_PACE_Pause(&MemFile->Pace, WriteBlockSize);
+         }
+      }      
+   } /* End while bytes */
+
+   return RetStatus;
+    
+} /* End LoadMemFromStagingBuf() */
+
+
+/******************************************************************************
+** Function: LoadPatchRecords
+**
+** Notes:
+**   1. The patch file's index and data must have been verified and the data
+**      staged before calling this function.
+**
+*/
+static bool LoadPatchRecords(const char *Filename)
+{
+
+   bool    RetStatus = true;
+   uint16  i;
+   uint32  StagingOffset = 0;
+   MEM_FILE_Patch_t *Patch = &MemFile->Patch;
+   
+   for (i=0; (i < Patch->RecordCnt) && (RetStatus == true); i++)
+   {
+      // Event sent by MEM_SIZEx_WriteBlock()
+      RetStatus = LoadMemFromStagingBuf(Patch->Memory[i].CpuAddr, Patch->Record[i].MemSize,
+                                        Patch->Memory[i].DirectAccess, Patch->Record[i].ByteCnt, StagingOffset);
+      if (RetStatus == true)
+      {
+         StagingOffset += Patch->Record[i].ByteCnt;
+      }
+      else
+      {
+         CFE_EVS_SendEvent(MEM_FILE_PROCESS_PATCH_FILE_EID, CFE_EVS_EventType_ERROR,
+                           "Patch file %s load stopped at record %u of %u, %u records were loaded",
+                           Filename, (unsigned int)(i+1), Patch->RecordCnt, (unsigned int)i);
+      }
+   }
+   
+   return RetStatus;
+   
+} /* End LoadPatchRecords() */
+
+
+/******************************************************************************
+** Function: ProcessCompareFile
+**
+** Notes:
+**   1. The file must be positioned at the start of the file data and the
+**      memory region must be verified for read access.
+**   2. An empty DiffFilename compares without creating a diff file.
+**   3. The compare results are only valid if the file's CRC is valid. A
+**      partial diff file is deleted if the CRC check or the compare fails.
+**
+*/
+static bool ProcessCompareFile(const char *Filename, osal_id_t FileHandle, const MEM_MGR_SecFileHdr_t *SecFileHdr,
+                               const MEMORY_VerifiedMemory_t *VerifiedMemory, const char *DiffFilename)
+{
+
+   bool    RetStatus = false;
+   bool    DiffFileCreated = true;
+   uint32  Crc;
+   MEM_FILE_Diff_t *Diff = &MemFile->Diff;
+   
+   Diff->FileOpen    = false;
+   Diff->WriteError  = false;
+   Diff->MismatchCnt = 0;
+   Diff->RunCnt      = 0;
+   Diff->FirstDiffOffset = 0;
+   Diff->RunOffset   = 0;
+   Diff->RunLen      = 0;
+   
+   if (DiffFilename[0] != '\0')
+   {
+      DiffFileCreated = CreateDiffFile(DiffFilename, SecFileHdr, VerifiedMemory->CpuAddr);
+   }
+   
+   if (DiffFileCreated)
+   {
+      if (CompareMemWithFile(Filename, FileHandle, SecFileHdr, VerifiedMemory->CpuAddr,
+                             VerifiedMemory->DirectAccess, &Crc))
+      {
+         if (Crc == SecFileHdr->Crc)
+         {
+            RetStatus = true;
+            if (Diff->FileOpen)
+            {
+               RetStatus = !Diff->WriteError && WriteDiffFileHdr(DiffFilename, SecFileHdr, VerifiedMemory->CpuAddr);
+            }
+         }
+         else
+         {
+            CFE_EVS_SendEvent(MEM_FILE_COMPARE_MEM_EID, CFE_EVS_EventType_ERROR,
+                              "Compare file CRC error, compare results are invalid: Computed=0x%08X Expected=0x%08X File: %s",
+                              (unsigned int)Crc, (unsigned int)SecFileHdr->Crc, Filename);
+         }
+      }
+   }
+   
+   if (Diff->FileOpen)
+   {
+      OS_close(Diff->FileHandle);
+      Diff->FileOpen = false;
+      if (!RetStatus)
+      {
+         OS_remove(DiffFilename);
+      }
+   }
+   
+   return RetStatus;
+   
+} /* End ProcessCompareFile() */
+
+/******************************************************************************
+** Function: ProcessLoadFile
+**
+** Notes:
+**   1. Perform all file verification before calling the function to perform
+**      the memory load
+**   2. Load data that fits in the staging buffer is read from the file once.
+**      The CRC is computed while the data is staged and memory is only written
+**      after the CRC is verified. Larger loads use two passes: the first pass
+**      verifies the file's CRC and the second pass loads memory.
+**   3. Compressed files follow the same staging rules using the
+**      decompressed size.
+**   4. Delta files are always processed in two passes, see
+**      LoadMemFromDeltaFile().
+**
+*/
+static bool ProcessLoadFile(const char *Filename, osal_id_t FileHandle,
+                            MEM_MGR_SecFileHdr_t *SecFileHdr, MEM_MGR_CpuAddr_Atom_t *CpuAddr)
+{
+
+   bool  RetStatus = false;
+   MEMORY_VerifiedMemory_t VerifiedMemory;
+
+         
+   if (ReadLoadFileHdrs(Filename, FileHandle, SecFileHdr))
+   {
+      if (MEMORY_VerifyAddr(SecFileHdr->SymbolAddr, SecFileHdr->MemType, SecFileHdr->MemSize,
+                            SecFileHdr->ByteCnt, MEM_MAP_ACCESS_WRITE, &VerifiedMemory))
+      {
+         *CpuAddr = VerifiedMemory.CpuAddr;
+         if (SecFileHdr->DumpType == MEM_MGR_DumpType_DELTA)
+         {
+            RetStatus = LoadMemFromDeltaFile(Filename, FileHandle, SecFileHdr, &VerifiedMemory);
+         }
+         else if (SecFileHdr->Compression != MEM_MGR_Compression_NONE)
+         {
+            RetStatus = LoadMemFromCompFile(Filename, FileHandle, SecFileHdr, &VerifiedMemory);
+         }
+         else if (SecFileHdr->ByteCnt <= MEM_MGR_LOAD_STAGING_BUF_SIZE)
+         {
+            if (StageLoadFile(Filename, FileHandle, SecFileHdr))
+            {
+               RetStatus = LoadMemFromStagingBuf(VerifiedMemory.CpuAddr, SecFileHdr->MemSize,
+                                                 VerifiedMemory.DirectAccess, SecFileHdr->ByteCnt, 0);
+            }
+         }
+         else
+         {
+            if (VerifyFileCrc(Filename, FileHandle, SecFileHdr))
+            {
+               RetStatus = LoadMemFromFile(VerifiedMemory.CpuAddr, FileHandle, Filename, SecFileHdr->MemSize,
+                                           VerifiedMemory.DirectAccess, SecFileHdr->ByteCnt);
+            }
+         }
+      }
+   }
+   
+   return RetStatus;
+   
+}/* End ProcessLoadFile() */
+
+
+/******************************************************************************
+** Function: ProcessPatchFile
+**
+** Notes:
+**   1. Every record is verified and the CRC of the index and data is
+**      verified in one pass over the file before any memory is written.
+**
+*/
+static bool ProcessPatchFile(const char *Filename, osal_id_t FileHandle, MEM_MGR_PatchFileHdr_t *PatchFileHdr)
+{
+
+   bool   RetStatus = false;
+   int32  OsStatus;
+   uint32 Crc;
+   CFE_FS_Header_t  CfeFileHeader;
+
+   MemFile->Patch.RecordCnt = 0;
+   
+   OsStatus = CFE_FS_ReadHeader(&CfeFileHeader, FileHandle);
+   if (OsStatus == FILE_PRI_HDR_BYTES)
+   {
+      OsStatus = OS_read(FileHandle, PatchFileHdr, PATCH_FILE_HDR_BYTES);
+      if (OsStatus == PATCH_FILE_HDR_BYTES)
+      {
+         if (ValidPatchFile(Filename, PatchFileHdr) && ReadPatchIndex(Filename, FileHandle, PatchFileHdr))
+         {
+            Crc = MEM_CRC_Calculate(MemFile->Patch.Record, PatchFileHdr->RecordCnt * PATCH_RECORD_BYTES,
+                                    0, PatchFileHdr->CrcType);
+            if (StageFileData(Filename, FileHandle, PatchFileHdr->ByteCnt, PatchFileHdr->CrcType, &Crc))
+            {
+               if (Crc == PatchFileHdr->Crc)
+               {
+                  RetStatus = LoadPatchRecords(Filename);
+               }
+               else
+               {
+                  CFE_EVS_SendEvent(MEM_FILE_PROCESS_PATCH_FILE_EID, CFE_EVS_EventType_ERROR,
+                                    "Patch file CRC error, memory not modified: Computed=0x%08X Expected=0x%08X File: %s",
+                                    (unsigned int)Crc, (unsigned int)PatchFileHdr->Crc, Filename);
+               }
+            }
+         }
+      }           
+      else
+      {
+         CFE_EVS_SendEvent(MEM_FILE_PROCESS_PATCH_FILE_EID, CFE_EVS_EventType_ERROR,
+                           "Error reading file %s patch header. Status=0x%08X, Expected bytes=%u",
+                           Filename, (unsigned int)OsStatus, (unsigned int)PATCH_FILE_HDR_BYTES);
+      }
+   }
+   else
+   {
+      CFE_EVS_SendEvent(MEM_FILE_PROCESS_PATCH_FILE_EID, CFE_EVS_EventType_ERROR,
+                        "Error reading file %s cFE header. Status=0x%08X, Expected bytes=%u",
+                        Filename, (unsigned int)OsStatus, (unsigned int)FILE_PRI_HDR_BYTES);
+   }
+   
+   return RetStatus;
+   
+} /* End ProcessPatchFile() */
+
+
+/******************************************************************************
+** Function: ReadCompBlock
+**
+** Notes:
+**   1. Read the next compressed block from the file and decompress it into
+**      RawBuf. Blocks can't decompress to more than MaxRawLen bytes.
+**   2. A block's RawLen must be a multiple of ElementLen so every block is
+**      written with whole memory elements and the next block stays aligned.
+**
+*/
+static bool ReadCompBlock(const char *Filename, uint8 *RawBuf, uint32 MaxRawLen, uint32 ElementLen, uint32 *RawLen)
+{
+
+   bool  RetStatus = false;
+   const uint8 *Data;
+   MEM_MGR_CompBlockHdr_t  BlockHdr;
+   
+   if (ReadCompData(Filename, COMP_BLOCK_HDR_BYTES, &Data))
+   {
+      memcpy(&BlockHdr, Data, COMP_BLOCK_HDR_BYTES);
+      if ((BlockHdr.RawLen == 0) || (BlockHdr.RawLen > MaxRawLen) ||
+          (BlockHdr.DataLen == 0) || (BlockHdr.DataLen > BlockHdr.RawLen))
+      {
+         CFE_EVS_SendEvent(MEM_FILE_DECOMPRESS_FILE_EID, CFE_EVS_EventType_ERROR,
+                           "Compressed load file %s block header error: RawLen=%u, DataLen=%u, Maximum RawLen=%u",
+                           Filename, BlockHdr.RawLen, BlockHdr.DataLen, (unsigned int)MaxRawLen);
+      }
+      else if ((BlockHdr.RawLen % ElementLen) != 0)
+      {
+         CFE_EVS_SendEvent(MEM_FILE_DECOMPRESS_FILE_EID, CFE_EVS_EventType_ERROR,
+                           "Compressed load file %s block header error: RawLen=%u is not a multiple of the %u byte memory size",
+                           Filename, BlockHdr.RawLen, (unsigned int)ElementLen);
+      }
+      else if (ReadCompData(Filename, BlockHdr.DataLen, &Data))
+      {
+         *RawLen = BlockHdr.RawLen;
+         if (BlockHdr.DataLen == BlockHdr.RawLen)
+         {
+            memcpy(RawBuf, Data, BlockHdr.RawLen);
+            RetStatus = true;
+         }
+         else if (MEM_LZ_Decompress(Data, BlockHdr.DataLen, RawBuf, BlockHdr.RawLen) == BlockHdr.RawLen)
+         {
+            RetStatus = true;
+         }
+         else
+         {
+            CFE_EVS_SendEvent(MEM_FILE_DECOMPRESS_FILE_EID, CFE_EVS_EventType_ERROR,
+                              "Compressed load file %s block decompression error: RawLen=%u, DataLen=%u",
+                              Filename, BlockHdr.RawLen, BlockHdr.DataLen);
+         }
+      }
+   }
+   
+   return RetStatus;
+   
+} /* End ReadCompBlock() */
+
+
+/******************************************************************************
+** Function: ReadCompData
+**
+** Notes:
+**   1. Return a pointer to the next Len bytes of compressed file data. The
+**      data is valid until the next call. Len must be less than or equal
+**      to MEM_FILE_IO_BLOCK_SIZE.
+**   2. The data is used in place if it's in the current MEM_PIPE read
+**      buffer, otherwise it's assembled in the reader's BlockBuf.
+**
+*/
+static bool ReadCompData(const char *Filename, uint32 Len, const uint8 **Data)
+{
+
+   bool    RetStatus = true;
+   uint32  DataLen = 0;
+   uint32  CopyLen;
+   uint32  ReadLen;
+   int32   FileBytesRead;
+   MEM_FILE_CompReader_t *Reader = &MemFile->CompReader;
+
+   while ((DataLen < Len) && (RetStatus == true))
+   {
+      if (Reader->PipeBufPos == Reader->PipeBufLen)
+      {
+         if (Reader->PipeBuf != NULL)
+         {
+            MEM_PIPE_ReleaseReadBuf();
+            Reader->PipeBuf = NULL;
+         }
+         
+         RetStatus = false;
+         if (Reader->FileBytesRemaining == 0)
+         {
+            CFE_EVS_SendEvent(MEM_FILE_DECOMPRESS_FILE_EID, CFE_EVS_EventType_ERROR,
+                              "Compressed load file %s ended in the middle of a block", Filename);
+         }
+         else
+         {
+            ReadLen = (Reader->FileBytesRemaining < MEM_FILE_IO_BLOCK_SIZE) ? Reader->FileBytesRemaining : MEM_FILE_IO_BLOCK_SIZE;
+            FileBytesRead = MEM_PIPE_GetReadBuf(&Reader->PipeBuf);
+            if (FileBytesRead == ReadLen)
+            {
+               Reader->PipeBufLen = ReadLen;
+               Reader->PipeBufPos = 0;
+               Reader->FileBytesRemaining -= ReadLen;
+               RetStatus = true;
+            }
+            else
+            {
+               CFE_EVS_SendEvent(MEM_FILE_DECOMPRESS_FILE_EID, CFE_EVS_EventType_ERROR,
+                                 "File read error %d while decompressing load file %s, expected %u bytes",
+                                 (int)FileBytesRead, Filename, (unsigned int)ReadLen);
+               Reader->PipeBuf = NULL;
+            }
+         }
+      } /* End if read buffer empty */
+      
+      if (RetStatus == true)
+      {
+         CopyLen = Reader->PipeBufLen - Reader->PipeBufPos;
+         if (CopyLen > (Len - DataLen))
+         {
+            CopyLen = Len - DataLen;
+         }
+         if (CopyLen == Len)
+         {
+            *Data = &Reader->PipeBuf[Reader->PipeBufPos];
+         }
+         else
+         {
+            memcpy(&Reader->BlockBuf[DataLen], &Reader->PipeBuf[Reader->PipeBufPos], CopyLen);
+            *Data = Reader->BlockBuf;
+         }
+         Reader->PipeBufPos += CopyLen;
+         DataLen += CopyLen;
+      }
+   } /* End while data */
+   
+   return RetStatus;
+   
+} /* End ReadCompData() */
+
+
+/******************************************************************************
+** Function: ReadDeltaIndex
+**
+** Notes:
+**   1. Read and verify a delta file's DeltaFileHdr and index. The file must
+**      be positioned at the DeltaFileHdr.
+**   2. The header must match the region size, the index must be in
+**      ascending block order and the file size must equal the headers,
+**      changed block data and index.
+**   3. The index is read from the end of the file, which relies on
+**      MEM_FILE_DumpCmd() truncating a file that it overwrites.
+**
+*/
+static bool ReadDeltaIndex(const char *Filename, osal_id_t FileHandle, const MEM_MGR_SecFileHdr_t *SecFileHdr,
+                           MEM_MGR_DeltaFileHdr_t *DeltaFileHdr)
+{
+
+   bool    RetStatus = false;
+   int32   OsStatus;
+   int32   FileLen = 0;
+   uint32  i;
+   uint32  Block;
+   uint32  BlockLen;
+   uint32  BlockCnt = 0;
+   uint32  IndexLen = 0;
+   uint32  DataLen = 0;
+   uint32 *ChangedBlock = MemFile->Delta.ChangedBlock;
+   
+   OsStatus = OS_read(FileHandle, DeltaFileHdr, DELTA_FILE_HDR_BYTES);
+   if (OsStatus == DELTA_FILE_HDR_BYTES)
+   {
+      if ((DeltaFileHdr->BlockSize != 0) && ((DeltaFileHdr->BlockSize % 4) == 0) &&
+          (DeltaFileHdr->BlockSize <= MEM_FILE_IO_BLOCK_SIZE))
+      {
+         BlockCnt = (SecFileHdr->ByteCnt / DeltaFileHdr->BlockSize) +
+                    (((SecFileHdr->ByteCnt % DeltaFileHdr->BlockSize) != 0) ? 1 : 0);
+      }
+      if ((BlockCnt == 0) || (BlockCnt != DeltaFileHdr->BlockCnt) || (BlockCnt > MEM_FILE_DELTA_MAX_BLOCKS) ||
+          (DeltaFileHdr->ChangedCnt > BlockCnt))
+      {
+         CFE_EVS_SendEvent(MEM_FILE_LOAD_DELTA_FILE_EID, CFE_EVS_EventType_ERROR,
+                           "Delta load file %s header error: BlockSize=%u, BlockCnt=%u, ChangedCnt=%u for a %u byte region",
+                           Filename, (unsigned int)DeltaFileHdr->BlockSize, (unsigned int)DeltaFileHdr->BlockCnt,
+                           (unsigned int)DeltaFileHdr->ChangedCnt, (unsigned int)SecFileHdr->ByteCnt);
+      }
+      else
+      {
+         IndexLen = DeltaFileHdr->ChangedCnt * DELTA_INDEX_ENTRY_BYTES;
+         FileLen  = OS_lseek(FileHandle, 0, OS_SEEK_END);
+         OsStatus = -1;
+         if (FileLen >= (int32)(DELTA_DATA_OFFSET + IndexLen))
+         {
+            OsStatus = OS_lseek(FileHandle, FileLen - IndexLen, OS_SEEK_SET);
+            if (OsStatus == (FileLen - (int32)IndexLen))
+            {
+               OsStatus = OS_read(FileHandle, ChangedBlock, IndexLen);
+            }
+         }
+         if (OsStatus == IndexLen)
+         {
+            RetStatus = true;
+         }
+         else
+         {
+            CFE_EVS_SendEvent(MEM_FILE_LOAD_DELTA_FILE_EID, CFE_EVS_EventType_ERROR,
+                              "Error reading file %s delta index of %u blocks. File length=%d, Status=%d",
+                              Filename, (unsigned int)DeltaFileHdr->ChangedCnt, (int)FileLen, (int)OsStatus);
+         }
+      }
+   } /* End if read delta header */
+   else
+   {
+      CFE_EVS_SendEvent(MEM_FILE_LOAD_DELTA_FILE_EID, CFE_EVS_EventType_ERROR,
+                        "Error reading file %s delta header. Status=0x%08X, Expected bytes=%u",
+                        Filename, (unsigned int)OsStatus, (unsigned int)DELTA_FILE_HDR_BYTES);
+   }
+
+   for (i=0; (i < DeltaFileHdr->ChangedCnt) && (RetStatus == true); i++)
+   {
+      Block = ChangedBlock[i];
+      if ((Block >= BlockCnt) || ((i > 0) && (Block <= ChangedBlock[i-1])))
+      {
+         CFE_EVS_SendEvent(MEM_FILE_LOAD_DELTA_FILE_EID, CFE_EVS_EventType_ERROR,
+                           "Delta load file %s index error: Entry %u block %u isn't in ascending order or exceeds %u blocks",
+                           Filename, (unsigned int)i, (unsigned int)Block, (unsigned int)BlockCnt);
+         RetStatus = false;
+      }
+      else
+      {
+         BlockLen = SecFileHdr->ByteCnt - Block * DeltaFileHdr->BlockSize;
+         DataLen += (BlockLen < DeltaFileHdr->BlockSize) ? BlockLen : DeltaFileHdr->BlockSize;
+      }
+   }
+   
+   if (RetStatus == true)
+   {
+      if (FileLen != (int32)(DELTA_DATA_OFFSET + DataLen + IndexLen))
+      {
+         CFE_EVS_SendEvent(MEM_FILE_LOAD_DELTA_FILE_EID, CFE_EVS_EventType_ERROR,
+                           "Delta load file %s size error: File length=%d, Expected=%u",
+                           Filename, (int)FileLen, (unsigned int)(DELTA_DATA_OFFSET + DataLen + IndexLen));
+         RetStatus = false;
+      }
+   }
+   
+   return RetStatus;
+   
+} /* End ReadDeltaIndex() */
+
+
+/******************************************************************************
+** Function: ReadLoadFileHdrs
+**
+** Notes:
+**   1. Read a load/dump file's cFE and MEM_MGR headers and validate the
+**      MEM_MGR header against the file. The file is left positioned at the
+**      start of the file data.
+**
+*/
+static bool ReadLoadFileHdrs(const char *Filename, osal_id_t FileHandle, MEM_MGR_SecFileHdr_t *SecFileHdr)
+{
+
+   bool  RetStatus = false;
+   int32 OsStatus; 
+   CFE_FS_Header_t  CfeFileHeader;
+
+   OsStatus = CFE_FS_ReadHeader(&CfeFileHeader, FileHandle);
+   if (OsStatus == FILE_PRI_HDR_BYTES)
+   {
+      OsStatus = OS_read(FileHandle, SecFileHdr, FILE_SEC_HDR_BYTES);
+      if (OsStatus == FILE_SEC_HDR_BYTES)
+      {
+         RetStatus = ValidLoadFile(Filename, SecFileHdr);
+      }           
+      else
+      {
+         CFE_EVS_SendEvent(MEM_FILE_PROCESS_LOAD_FILE_EID, CFE_EVS_EventType_ERROR,
+                           "Error reading file %s MEM_MGR header. Status=0x%08X, Expected bytes=%u",
+                           Filename, (unsigned int)OsStatus, (unsigned int)FILE_SEC_HDR_BYTES);
+
+      } /* end OS_read if */
+
+   } /* End valid cFE header read */
+   else
+   {
+      CFE_EVS_SendEvent(MEM_FILE_PROCESS_LOAD_FILE_EID, CFE_EVS_EventType_ERROR,
+                        "Error reading file %s cFE header. Status=0x%08X, Expected bytes=%u",
+                        Filename, (unsigned int)OsStatus, (unsigned int)FILE_PRI_HDR_BYTES);
+
+   } /* End invalid cFE header read */
+   
+   return RetStatus;
+   
+} /* End ReadLoadFileHdrs() */
+
+
+/******************************************************************************
+** Function: ReadPatchIndex
+**
+** Notes:
+**   1. Read the patch file's index and verify each record's memory. The file
+**      is left positioned at the start of the record data.
+**   2. The record ByteCnts must add up to the file header's ByteCnt so the
+**      staged data can be divided between the records.
+**   3. Each record's ByteCnt must be a whole number of its memory elements
+**      and no two records can write the same memory, otherwise the load
+**      would depend on the record order.
+**
+*/
+static bool ReadPatchIndex(const char *Filename, osal_id_t FileHandle, const MEM_MGR_PatchFileHdr_t *PatchFileHdr)
+{
+
+   bool   RetStatus = false;
+   int32  OsStatus;
+   uint16 i;
+   uint16 j;
+   uint32 ElementLen;
+   uint32 IndexBytes = PatchFileHdr->RecordCnt * PATCH_RECORD_BYTES;
+   uint64 ByteCnt = 0;
+   MEM_FILE_Patch_t *Patch = &MemFile->Patch;
+
+   OsStatus = OS_read(FileHandle, Patch->Record, IndexBytes);
+   if (OsStatus == IndexBytes)
+   {
+      RetStatus = true;
+      for (i=0; (i < PatchFileHdr->RecordCnt) && (RetStatus == true); i++)
+      {
+         /* MEMORY_VerifyAddr() sends error events */
+         RetStatus = MEMORY_VerifyAddr(Patch->Record[i].SymbolAddr, Patch->Record[i].MemType, Patch->Record[i].MemSize,
+                                       Patch->Record[i].ByteCnt, MEM_MAP_ACCESS_WRITE, &Patch->Memory[i]);
+         if (RetStatus == true)
+         {
+            ElementLen = 1;
+            if ((Patch->Record[i].MemSize == MEM_MGR_MemSize_16) || (Patch->Record[i].MemSize == MEM_MGR_MemSize_32))
+            {
+               ElementLen = Patch->Record[i].MemSize;  // MemSize value is the number of bytes
+            }
+            if ((Patch->Record[i].ByteCnt % ElementLen) == 0)
+            {
+               ByteCnt += Patch->Record[i].ByteCnt;
+            }
+            else
+            {
+               CFE_EVS_SendEvent(MEM_FILE_PROCESS_PATCH_FILE_EID, CFE_EVS_EventType_ERROR,
+                                 "Patch file %s record %u ByteCnt %u is not a multiple of the %u byte memory size",
+                                 Filename, (unsigned int)(i+1), (unsigned int)Patch->Record[i].ByteCnt,
+                                 (unsigned int)ElementLen);
+               RetStatus = false;
+            }
+         }
+         else
+         {
+            CFE_EVS_SendEvent(MEM_FILE_PROCESS_PATCH_FILE_EID, CFE_EVS_EventType_ERROR,
+                              "Patch file %s record %u memory verification failed",
+                              Filename, (unsigned int)(i+1));
+         }
+      } /* End record loop */
+      
+      for (i=0; (i < PatchFileHdr->RecordCnt) && (RetStatus == true); i++)
+      {
+         for (j=i+1; (j < PatchFileHdr->RecordCnt) && (RetStatus == true); j++)
+         {
+            if ((Patch->Memory[i].CpuAddr < (Patch->Memory[j].CpuAddr + Patch->Record[j].ByteCnt)) &&
+                (Patch->Memory[j].CpuAddr < (Patch->Memory[i].CpuAddr + Patch->Record[i].ByteCnt)))
+            {
+               CFE_EVS_SendEvent(MEM_FILE_PROCESS_PATCH_FILE_EID, CFE_EVS_EventType_ERROR,
+                                 "Patch file %s records %u and %u write overlapping memory",
+                                 Filename, (unsigned int)(i+1), (unsigned int)(j+1));
+               RetStatus = false;
+            }
+         }
+      } /* End overlap loop */
+      
+      if (RetStatus == true)
+      {
+         if (ByteCnt == PatchFileHdr->ByteCnt)
+         {
+            Patch->RecordCnt = PatchFileHdr->RecordCnt;
+         }
+         else
+         {
+            CFE_EVS_SendEvent(MEM_FILE_PROCESS_PATCH_FILE_EID, CFE_EVS_EventType_ERROR,
+                              "Patch file %s record byte counts total %llu, header ByteCnt is %u",
+                              Filename, (unsigned long long)ByteCnt, (unsigned int)PatchFileHdr->ByteCnt);
+            RetStatus = false;
+         }
+      }
+   }
+   else
+   {
+      CFE_EVS_SendEvent(MEM_FILE_PROCESS_PATCH_FILE_EID, CFE_EVS_EventType_ERROR,
+                        "Error reading file %s patch index. Status=0x%08X, Expected bytes=%u",
+                        Filename, (unsigned int)OsStatus, (unsigned int)IndexBytes);
+   }
+
+   return RetStatus;
+
+} /* End ReadPatchIndex() */
+
+
+/******************************************************************************
+** Function: SaveDeltaRegion
+**
+** Notes:
+**   1. Copy the block CRCs of a completed dump to the region's table entry.
+**      A region without an entry replaces an unused entry or the least
+**      recently dumped region.
+**
+*/
+static void SaveDeltaRegion(MEM_MGR_CpuAddr_Atom_t CpuAddr, uint32 ByteCnt, uint32 ImageCrc)
+{
+
+   uint16  i;
+   MEM_FILE_Delta_t       *Delta  = &MemFile->Delta;
+   MEM_FILE_DeltaRegion_t *Region = FindDeltaRegion(CpuAddr, ByteCnt);
+   
+   if (Region == NULL)
+   {
+      for (i=0; i < MEM_FILE_DELTA_MAX_REGIONS; i++)
+      {
+         if ((Region == NULL) || !Delta->Region[i].InUse || (Delta->Region[i].DumpSeq < Region->DumpSeq))
+         {
+            Region = &Delta->Region[i];
+            if (!Region->InUse)
+            {
+               break;
+            }
+         }
+      }
+   }
+   
+   Region->InUse     = true;
+   Region->CpuAddr   = CpuAddr;
+   Region->ByteCnt   = ByteCnt;
+   Region->BlockSize = Delta->BlockSize;
+   Region->BlockCnt  = (ByteCnt / Delta->BlockSize) + (((ByteCnt % Delta->BlockSize) != 0) ? 1 : 0);
+   Region->ImageCrc  = ImageCrc;
+   Region->DumpSeq   = ++Delta->DumpSeq;
+   memcpy(Region->BlockCrc, Delta->BlockCrc, Region->BlockCnt * sizeof(uint32));
+   
+} /* End SaveDeltaRegion() */
+
+
+/******************************************************************************
+** Function: SegmentFilename
+**
+** Notes:
+**   1. The 3 digit segment number is inserted before the filename's
+**      extension or appended if the filename doesn't have one. For example
+**      segment 2 of "/cf/dump.dat" is "/cf/dump_002.dat".
+**   2. SegFilename must have OS_MAX_PATH_LEN bytes. An error event is sent
+**      if the segment filename doesn't fit.
+**
+*/
+static bool SegmentFilename(char *SegFilename, const char *Filename, uint16 Segment)
+{
+
+   bool         RetStatus = false;
+   int          FilenameLen;
+   const char  *PathSep = strrchr(Filename, '/');
+   const char  *Ext     = strrchr(Filename, '.');
+   
+   if ((Ext == NULL) || (Ext == Filename) || ((PathSep != NULL) && (Ext <= (PathSep + 1))))
+   {
+      Ext = &Filename[strlen(Filename)];
+   }
+   
+   FilenameLen = snprintf(SegFilename, OS_MAX_PATH_LEN, "%.*s_%03u%s",
+                          (int)(Ext - Filename), Filename, (unsigned int)Segment, Ext);
+   if ((FilenameLen > 0) && (FilenameLen < OS_MAX_PATH_LEN))
+   {
+      RetStatus = true;
+   }
+   else
+   {
+      CFE_EVS_SendEvent(MEM_FILE_DUMP_SEGMENT_FILES_EID, CFE_EVS_EventType_ERROR,
+                        "Segment %u filename for %s exceeds the %d character path limit",
+                        (unsigned int)Segment, Filename, OS_MAX_PATH_LEN-1);
+   }
+   
+   return RetStatus;
+
+} /* End SegmentFilename() */
+
+
+/******************************************************************************
+** Function: StageFileData
+**
+** Notes:
+**   1. Assumes the file is positioned at the start of the data and the data
+**      fits in the staging buffer.
+**   2. The file is read once. Each block's CRC is computed as it is copied
+**      into the staging buffer so a second pass over the file isn't needed.
+**      The CRC calculation continues from the Crc input value.
+**   3. The MEM_PIPE helper task reads the next block while the current block
+**      is staged.
+**
+*/
+static bool StageFileData(const char *Filename, osal_id_t FileHandle, uint32 ByteCnt,
+                          MEM_MGR_CrcType_Enum_t CrcType, uint32 *Crc)
+{
+   
+   uint32  BytesRemaining = ByteCnt;
+   uint32  FileReadBlockSize = MEM_FILE_IO_BLOCK_SIZE;
+   uint8  *StagingPtr = MemFile->StagingBuf;
+   uint8  *DataBuf;
+   int32   FileBytesRead;
+   
+   MEM_PACE_Start(&MemFile->Pace);
+   if (MEM_PIPE_StartRead(FileHandle, FileReadBlockSize, BytesRemaining))
+   {
+      while (BytesRemaining != 0)
+      {
+         if (BytesRemaining < FileReadBlockSize)
+         {
+            FileReadBlockSize = BytesRemaining;
+         }
+
+         FileBytesRead = MEM_PIPE_GetReadBuf(&DataBuf);
+         if (FileBytesRead == FileReadBlockSize)
+         {
+            memcpy(StagingPtr, DataBuf, FileBytesRead);
+            MEM_PIPE_ReleaseReadBuf();
+            
+            *Crc = MEM_CRC_Calculate(StagingPtr, FileBytesRead, *Crc, CrcType);
+            
+            StagingPtr     += FileBytesRead;
+            BytesRemaining -= FileBytesRead;
+            
+            MEM_PACE_Pause(&MemFile->Pace, FileBytesRead);
+         }
+         else
+         {
+            CFE_EVS_SendEvent(MEM_FILE_STAGE_LOAD_FILE_EID, CFE_EVS_EventType_ERROR,
+                              "File read error %d while staging load file %s, expected %u bytes",
+                              (int)FileBytesRead, Filename, (unsigned int)FileReadBlockSize);
+            break;
+         }
+      } /* End while bytes */
+      
+      MEM_PIPE_Stop();
+   } /* End if pipe started */
+   
+   return (BytesRemaining == 0);
+   
+} /* End StageFileData() */
+
+
+/******************************************************************************
+** Function: StageLoadFile
+**
+** Notes:
+**   1. Assumes the file is positioned at the start of the load data and the
+**      load data fits in the staging buffer.
+**
+*/
+static bool StageLoadFile(const char *Filename, osal_id_t FileHandle, const MEM_MGR_SecFileHdr_t *SecFileHdr)
+{
+   
+   bool    RetStatus = false;
+   uint32  Crc = 0;
+   
+   if (StageFileData(Filename, FileHandle, SecFileHdr->ByteCnt, SecFileHdr->CrcType, &Crc))
+   {
+      if (Crc == SecFileHdr->Crc)
+      {
+         RetStatus = true;
+      }
+      else
+      {
+         CFE_EVS_SendEvent(MEM_FILE_STAGE_LOAD_FILE_EID, CFE_EVS_EventType_ERROR,
+                           "Load file CRC error, memory not modified: Computed=0x%08X Expected=0x%08X File: %s",
+                           (unsigned int)Crc, (unsigned int)SecFileHdr->Crc, Filename);
+      }
+   }
+   
+   return RetStatus;
+   
+} /* End StageLoadFile() */
+
+
+/******************************************************************************
+** Function: UpdateBlockCrcs
+**
+** Notes:
+**   1. Add Len bytes of dump data starting at region offset Offset to the
+**      delta block CRCs. The data may start and end anywhere in a block.
+**
+*/
+static void UpdateBlockCrcs(const uint8 *Data, uint32 Offset, uint32 Len, MEM_MGR_CrcType_Enum_t CrcType)
+{
+
+   uint32  Block;
+   uint32  BlockOffset;
+   uint32  SliceLen;
+   MEM_FILE_Delta_t *Delta = &MemFile->Delta;
+   
+   while (Len != 0)
+   {
+      Block       = Offset / Delta->BlockSize;
+      BlockOffset = Offset % Delta->BlockSize;
+      SliceLen    = Delta->BlockSize - BlockOffset;
+      if (SliceLen > Len)
+      {
+         SliceLen = Len;
+      }
+      
+      Delta->BlockCrc[Block] = MEM_CRC_Calculate(Data, SliceLen, (BlockOffset == 0) ? 0 : Delta->BlockCrc[Block], CrcType);
+      
+      Data   += SliceLen;
+      Offset += SliceLen;
+      Len    -= SliceLen;
+   }
+   
+} /* End UpdateBlockCrcs() */
+
+
+/******************************************************************************
+** Function: ValidLoadFile
+**
+** Notes:
+**   1. Verify the load file's size, compression and CRC type. The CRC is
+**      verified while the load data is processed.
+**   2. A compressed file's size isn't known until it's decompressed so it
+**      only needs to be large enough for one compressed block.
+**   3. A delta file's size is verified against its index when it's loaded.
+**      Delta files can't be compressed.
+**
+*/
+static bool ValidLoadFile(const char *Filename, const MEM_MGR_SecFileHdr_t *SecFileHdr)
+{
+   bool       RetStatus = false;
+   int32      OsStatus;
+   bool       ValidSize;
+   size_t     SizeFromHdr;
+   int32      SizeFromOs;
+   os_fstat_t FileStats;
+   
+   memset(&FileStats, 0, sizeof(FileStats));
+
+   if (SecFileHdr->Compression > MEM_MGR_Compression_LZ)
+   {
+      CFE_EVS_SendEvent(MEM_FILE_VALID_LOAD_FILE_EID, CFE_EVS_EventType_ERROR,
+                        "Load file invalid compression %d. See mem_mgr.xml Compression for valid values. File: %s",
+                        SecFileHdr->Compression, Filename);
+   }
+   else if (SecFileHdr->DumpType > MEM_MGR_DumpType_DELTA)
+   {
+      CFE_EVS_SendEvent(MEM_FILE_VALID_LOAD_FILE_EID, CFE_EVS_EventType_ERROR,
+                        "Load file invalid dump type %d. See mem_mgr.xml DumpType for valid values. File: %s",
+                        SecFileHdr->DumpType, Filename);
+   }
+   else if ((SecFileHdr->DumpType == MEM_MGR_DumpType_DELTA) && (SecFileHdr->Compression != MEM_MGR_Compression_NONE))
+   {
+      CFE_EVS_SendEvent(MEM_FILE_VALID_LOAD_FILE_EID, CFE_EVS_EventType_ERROR,
+                        "Load file error, delta files can't be compressed. File: %s", Filename);
+   }
+   else
+   {
+
+      OsStatus = OS_stat(Filename, &FileStats);
+      if (OsStatus == OS_SUCCESS)
+      {
+         SizeFromOs  = OS_FILESTAT_SIZE(FileStats);
+         if (SecFileHdr->DumpType == MEM_MGR_DumpType_DELTA)
+         {
+            SizeFromHdr = DELTA_DATA_OFFSET;
+            ValidSize   = (SizeFromOs >= SizeFromHdr);
+         }
+         else if (SecFileHdr->Compression == MEM_MGR_Compression_NONE)
+         {
+            SizeFromHdr = SecFileHdr->ByteCnt + FILE_HDR_BYTES;
+            ValidSize   = (SizeFromOs == SizeFromHdr);
+         }
+         else
+         {
+            SizeFromHdr = FILE_HDR_BYTES + COMP_BLOCK_HDR_BYTES + 1;
+            ValidSize   = (SizeFromOs >= SizeFromHdr);
+         }
+         if (ValidSize)
+         {
+            if (MEM_CRC_ValidType(SecFileHdr->CrcType))
             {
                RetStatus = true;
             }
             else
             {
                CFE_EVS_SendEvent(MEM_FILE_VALID_LOAD_FILE_EID, CFE_EVS_EventType_ERROR,
-                                 "Load file CRC error: Computed=%d Expected=%u File: %s",
-                                 (int)SizeFromOs,(unsigned int)SizeFromHdr, Filename);
-
+                                 "Load file invalid CRC type %d. See mem_mgr.xml CrcType for valid types. File: %s",
+                                 SecFileHdr->CrcType, Filename);      
             }
          }
+         else
+         {
+            CFE_EVS_SendEvent(MEM_FILE_VALID_LOAD_FILE_EID, CFE_EVS_EventType_ERROR,
+                             "Load file size error: Reported by OS=%d Expected=%u File: %s",
+                             (int)SizeFromOs,(unsigned int)SizeFromHdr, Filename);
+         }
       }
       else
       {
          CFE_EVS_SendEvent(MEM_FILE_VALID_LOAD_FILE_EID, CFE_EVS_EventType_ERROR,
-                          "Load file size error: Reported by OS=%d Expected=%u File: %s",
-                          (int)SizeFromOs,(unsigned int)SizeFromHdr, Filename);
+                           "Load file OS_stat error: Status=0x%08X File: %s",
+                           (unsigned int)OsStatus, Filename);
       }
+
+   } /* End if valid header */
+
+   return RetStatus;
+
+} /* End ValidLoadFile() */
+
+
+/******************************************************************************
+** Function: ValidPatchFile
+**
+** Notes:
+**   1. Verify the patch file's record count, data size, CRC type and file
+**      size. The record data is staged so the total must fit in the staging
+**      buffer.
+**
+*/
+static bool ValidPatchFile(const char *Filename, const MEM_MGR_PatchFileHdr_t *PatchFileHdr)
+{
+   bool       RetStatus = false;
+   int32      OsStatus;
+   size_t     SizeFromHdr;
+   int32      SizeFromOs;
+   os_fstat_t FileStats;
+   
+   memset(&FileStats, 0, sizeof(FileStats));
+
+   if ((PatchFileHdr->RecordCnt == 0) || (PatchFileHdr->RecordCnt > MEM_FILE_PATCH_MAX_RECORDS))
+   {
+      CFE_EVS_SendEvent(MEM_FILE_PROCESS_PATCH_FILE_EID, CFE_EVS_EventType_ERROR,
+                        "Patch file record count %u must be between 1 and %u. File: %s",
+                        PatchFileHdr->RecordCnt, MEM_FILE_PATCH_MAX_RECORDS, Filename);
+   }
+   else if (PatchFileHdr->ByteCnt > MEM_MGR_LOAD_STAGING_BUF_SIZE)
+   {
+      CFE_EVS_SendEvent(MEM_FILE_PROCESS_PATCH_FILE_EID, CFE_EVS_EventType_ERROR,
+                        "Patch file data byte count %u exceeds the %u byte staging buffer. File: %s",
+                        (unsigned int)PatchFileHdr->ByteCnt, MEM_MGR_LOAD_STAGING_BUF_SIZE, Filename);
+   }
+   else if (!MEM_CRC_ValidType(PatchFileHdr->CrcType))
+   {
+      CFE_EVS_SendEvent(MEM_FILE_PROCESS_PATCH_FILE_EID, CFE_EVS_EventType_ERROR,
+                        "Patch file invalid CRC type %d. See mem_mgr.xml CrcType for valid types. File: %s",
+                        PatchFileHdr->CrcType, Filename);      
    }
    else
    {
-      CFE_EVS_SendEvent(MEM_FILE_VALID_LOAD_FILE_EID, CFE_EVS_EventType_ERROR,
-                        "Load file OS_stat error: Status=0x%08X File: %s",
-                        (unsigned int)OsStatus, Filename);
+      OsStatus = OS_stat(Filename, &FileStats);
+      if (OsStatus == OS_SUCCESS)
+      {
+         SizeFromOs  = OS_FILESTAT_SIZE(FileStats);
+         SizeFromHdr = FILE_PRI_HDR_BYTES + PATCH_FILE_HDR_BYTES + 
+                       PatchFileHdr->RecordCnt * PATCH_RECORD_BYTES + PatchFileHdr->ByteCnt;
+         if (SizeFromOs == SizeFromHdr)
+         {
+            RetStatus = true;
+         }
+         else
+         {
+            CFE_EVS_SendEvent(MEM_FILE_PROCESS_PATCH_FILE_EID, CFE_EVS_EventType_ERROR,
+                             "Patch file size error: Reported by OS=%d Expected=%u File: %s",
+                             (int)SizeFromOs,(unsigned int)SizeFromHdr, Filename);
+         }
+      }
+      else
+      {
+         CFE_EVS_SendEvent(MEM_FILE_PROCESS_PATCH_FILE_EID, CFE_EVS_EventType_ERROR,
+                           "Patch file OS_stat error: Status=0x%08X File: %s",
+                           (unsigned int)OsStatus, Filename);
+      }
+   }
+   
+   return RetStatus;
+
+} /* End ValidPatchFile() */
+
+
+/******************************************************************************
+** Function: VerifyFileCrc
+**
+** Notes:
+**   1. Assumes the file is positioned at the start of the load data. 
+**
+*/
+static bool VerifyFileCrc(const char *Filename, osal_id_t FileHandle, const MEM_MGR_SecFileHdr_t *SecFileHdr)
+{
+   
+   bool   RetStatus = false;
+   uint32 FileCrc;
+   
+   if (ComputeFileCrc(Filename, FileHandle, SecFileHdr->CrcType, SecFileHdr->ByteCnt, &FileCrc))
+   {
+      if (FileCrc == SecFileHdr->Crc)
+      {
+         RetStatus = true;
+      }
+      else
+      {
+         CFE_EVS_SendEvent(MEM_FILE_VALID_LOAD_FILE_EID, CFE_EVS_EventType_ERROR,
+                           "Load file CRC error: Computed=0x%08X Expected=0x%08X File: %s",
+                           (unsigned int)FileCrc, (unsigned int)SecFileHdr->Crc, Filename);
+      }
    }
+   
+   return RetStatus;
+   
+} /* End VerifyFileCrc() */
+
 
+/******************************************************************************
+** Function: WriteDiffFileHdr
+**
+** Notes:
+**   1. Write the diff file header with the current mismatch and run counts.
+**      The file position is left at the end of the header.
+**
+*/
+static bool WriteDiffFileHdr(const char *DiffFilename, const MEM_MGR_SecFileHdr_t *SecFileHdr,
+                             MEM_MGR_CpuAddr_Atom_t StartAddr)
+{
+   
+   bool   RetStatus = false;
+   int32  OsStatus;
+   MEM_MGR_DiffFileHdr_t DiffFileHdr;
+   
+   memset(&DiffFileHdr, 0, sizeof(MEM_MGR_DiffFileHdr_t));
+   
+   DiffFileHdr.SymbolAddr  = SecFileHdr->SymbolAddr;
+   DiffFileHdr.MemType     = SecFileHdr->MemType;
+   DiffFileHdr.MemSize     = SecFileHdr->MemSize;
+   DiffFileHdr.ByteCnt     = SecFileHdr->ByteCnt;
+   DiffFileHdr.StartAddr   = StartAddr;
+   DiffFileHdr.MismatchCnt = MemFile->Diff.MismatchCnt;
+   DiffFileHdr.RunCnt      = MemFile->Diff.RunCnt;
+   
+   OsStatus = OS_lseek(MemFile->Diff.FileHandle, FILE_PRI_HDR_BYTES, OS_SEEK_SET);
+   if (OsStatus == FILE_PRI_HDR_BYTES)
+   {
+      OsStatus = OS_write(MemFile->Diff.FileHandle, &DiffFileHdr, DIFF_FILE_HDR_BYTES);
+      if (OsStatus == DIFF_FILE_HDR_BYTES)
+      {
+         RetStatus = true;
+      }
+   }
+   
+   if (RetStatus == false)
+   {
+      CFE_EVS_SendEvent(MEM_FILE_COMPARE_MEM_EID, CFE_EVS_EventType_ERROR,
+                        "Error writing diff file %s header. Status=0x%08X",
+                        DiffFilename, (unsigned int)OsStatus);
+   }
+   
    return RetStatus;
+   
+} /* End WriteDiffFileHdr() */
 
-} /* End ValidLoadFile() */
+/******************************************************************************
+** Function: WriteSecFileHdrCrc
+**
+** Notes:
+**   1. Rewrite the secondary header after the data CRC has been computed.
+**      The file position is left at the end of the secondary header.
+**
+*/
+static bool WriteSecFileHdrCrc(const char *Filename, osal_id_t FileHandle, const MEM_MGR_SecFileHdr_t *SecFileHdr)
+{
+   
+   bool   RetStatus = false;
+   int32  OsStatus;
+   
+   OsStatus = OS_lseek(FileHandle, FILE_PRI_HDR_BYTES, OS_SEEK_SET);
+   if (OsStatus == FILE_PRI_HDR_BYTES)
+   {
+      OsStatus = OS_write(FileHandle, SecFileHdr, FILE_SEC_HDR_BYTES);
+      if (OsStatus == FILE_SEC_HDR_BYTES)
+      {
+         RetStatus = true;
+      }
+   }
+   
+   if (RetStatus == false)
+   {
+      CFE_EVS_SendEvent(MEM_FILE_WRITE_SEC_HDR_CRC_EID, CFE_EVS_EventType_ERROR,
+                        "Error writing CRC 0x%08X to file %s MEM_MGR header. Status=0x%08X",
+                        (unsigned int)SecFileHdr->Crc, Filename, (unsigned int)OsStatus);
+   }
+   
+   return RetStatus;
+   
+} /* End WriteSecFileHdrCrc() */
@@ -29,6 +29,8 @@
 
 #include "app_cfg.h"
 #include "memory.h"
+#include "mem_lz.h"
+#include "mem_pace.h"
 
 /***********************/
 /** Macro Definitions **/
@@ -49,11 +51,160 @@
 #define MEM_FILE_DUMP_MEM_TO_FILE_EID   (MEM_FILE_BASE_EID + 7)
 #define MEM_FILE_LOAD_MEM_FROM_FILE_EID (MEM_FILE_BASE_EID + 8)
 #define MEM_FILE_VALID_LOAD_FILE_EID    (MEM_FILE_BASE_EID + 9)
+#define MEM_FILE_STAGE_LOAD_FILE_EID    (MEM_FILE_BASE_EID + 10)
+#define MEM_FILE_WRITE_SEC_HDR_CRC_EID  (MEM_FILE_BASE_EID + 11)
+#define MEM_FILE_COMPARE_CMD_EID        (MEM_FILE_BASE_EID + 12)
+#define MEM_FILE_COMPARE_MEM_EID        (MEM_FILE_BASE_EID + 13)
+#define MEM_FILE_DECOMPRESS_FILE_EID    (MEM_FILE_BASE_EID + 14)
+#define MEM_FILE_LOAD_PATCH_CMD_EID     (MEM_FILE_BASE_EID + 15)
+#define MEM_FILE_PROCESS_PATCH_FILE_EID (MEM_FILE_BASE_EID + 16)
+#define MEM_FILE_DUMP_DELTA_TO_FILE_EID (MEM_FILE_BASE_EID + 17)
+#define MEM_FILE_LOAD_DELTA_FILE_EID    (MEM_FILE_BASE_EID + 18)
+#define MEM_FILE_DUMP_REGIONS_CMD_EID   (MEM_FILE_BASE_EID + 19)
+#define MEM_FILE_CREATE_REGIONS_FILE_EID (MEM_FILE_BASE_EID + 20)
+#define MEM_FILE_DUMP_SEGMENT_FILES_EID  (MEM_FILE_BASE_EID + 21)
 
 /**********************/
 /** Type Definitions **/
 /**********************/
 
+
+/******************************************************************************
+** Compare diff state
+**
+** - The current run collects contiguous differing bytes until a matching
+**   byte or MEM_FILE_DIFF_RUN_MAX_LEN ends it and it's written to the diff
+**   file.
+*/
+
+typedef struct
+{
+
+   bool       FileOpen;
+   bool       WriteError;
+   osal_id_t  FileHandle;
+   
+   uint32     MismatchCnt;
+   uint32     RunCnt;
+   uint32     FirstDiffOffset;
+
+   uint32     RunOffset;
+   uint32     RunLen;
+   uint8      RunExpected[MEM_FILE_DIFF_RUN_MAX_LEN];
+   uint8      RunActual[MEM_FILE_DIFF_RUN_MAX_LEN];
+
+} MEM_FILE_Diff_t;
+
+
+/******************************************************************************
+** Dump status
+**
+** - FileDataLen is the number of file bytes following the file headers and
+**   CompRatio is ByteCnt/FileDataLen times 100, saturated at 0xFFFF.
+** - ChangedCnt is the number of blocks written by a delta dump.
+** - FileDataLen is the total of every file written by a segmented dump.
+*/
+
+typedef struct
+{
+
+   uint8   Compression;   // MEM_MGR_Compression_Enum_t
+   uint8   DumpType;      // MEM_MGR_DumpType_Enum_t
+   uint32  ByteCnt;
+   uint32  FileDataLen;
+   uint16  CompRatio;
+   uint32  ChangedCnt;
+   uint16  SegmentCnt;
+
+} MEM_FILE_DumpStatus_t;
+
+
+/******************************************************************************
+** Compressed load file reader
+**
+** - Compressed blocks are variable length so they're extracted from the
+**   fixed size MEM_PIPE read buffers. A block that spans two read buffers
+**   is assembled in BlockBuf, otherwise it's used in place.
+*/
+
+typedef struct
+{
+
+   uint8   *PipeBuf;            // Current MEM_PIPE read buffer, NULL if none is held
+   uint32   PipeBufLen;
+   uint32   PipeBufPos;
+   uint32   FileBytesRemaining; // File data bytes that haven't been read from MEM_PIPE
+
+   uint8    BlockBuf[MEM_FILE_IO_BLOCK_SIZE];
+
+} MEM_FILE_CompReader_t;
+
+
+/******************************************************************************
+** Patch file index
+**
+** - Record is the index read from the file and Memory is each record's
+**   verified memory.
+** - A multi-region dump uses the same index for the regions it writes.
+*/
+
+typedef struct
+{
+
+   uint16  RecordCnt;
+   
+   MEM_MGR_PatchRecord_t    Record[MEM_FILE_PATCH_MAX_RECORDS];
+   MEMORY_VerifiedMemory_t  Memory[MEM_FILE_PATCH_MAX_RECORDS];
+
+} MEM_FILE_Patch_t;
+
+
+/******************************************************************************
+** Delta dump region
+**
+** - BlockCrc holds the CRC of each block in the region's last dump and
+**   ImageCrc is that dump's file CRC.
+** - DumpSeq orders the regions so the least recently dumped region is
+**   replaced when the table is full.
+*/
+
+typedef struct
+{
+
+   bool    InUse;
+   MEM_MGR_CpuAddr_Atom_t  CpuAddr;
+   uint32  ByteCnt;
+   uint32  BlockSize;
+   uint32  BlockCnt;
+   uint32  ImageCrc;
+   uint32  DumpSeq;
+   
+   uint32  BlockCrc[MEM_FILE_DELTA_MAX_BLOCKS];
+
+} MEM_FILE_DeltaRegion_t;
+
+
+/******************************************************************************
+** Delta dump state
+**
+** - BlockSize is the current dump's block size, zero if the region is too
+**   large to record. The current dump's block CRCs are collected in BlockCrc
+**   and only copied to the region table after the dump file is complete.
+** - ChangedBlock is the index of a delta file being written or loaded.
+*/
+
+typedef struct
+{
+
+   uint32  DumpSeq;
+   uint32  BlockSize;
+   uint32  BlockCrc[MEM_FILE_DELTA_MAX_BLOCKS];
+   uint32  ChangedBlock[MEM_FILE_DELTA_MAX_BLOCKS];
+   
+   MEM_FILE_DeltaRegion_t  Region[MEM_FILE_DELTA_MAX_REGIONS];
+
+} MEM_FILE_Delta_t;
+
         
 /******************************************************************************
 ** MEM_FILE_Class
@@ -68,23 +219,34 @@ typedef struct
    
    const INITBL_Class_t *IniTbl;
    
+   /*
+   ** Telemetry Packets
+   */
+   
+   MEM_MGR_CompareTlm_t  CompareTlm;
+   
    /*
    ** MEM_FILE State Data
    */
       
    MEMORY_CmdStatus_t CmdStatus;
 
-   uint16 TaskBlockCount;
-   uint32 TaskBlockLimit;
-   uint32 TaskBlockDelay;
-   uint32 TaskPerfId;
+   MEM_PACE_Class_t Pace;
    
    uint32 LoadBlockSize;
    uint32 DumpBlockSize;
-   uint32 FillBlockSize;
    
    char   Filename[OS_MAX_PATH_LEN];
-   uint8  IoBuf[MEM_FILE_IO_BLOCK_SIZE];
+   uint8  StagingBuf[MEM_MGR_LOAD_STAGING_BUF_SIZE];  // Single-pass load staging area, see mem_mgr_platform_cfg.h
+   
+   MEM_FILE_DumpStatus_t  DumpStatus;
+   MEM_LZ_Arena_t         LzArena;  // Compressor working memory, only used by the child task
+   MEM_FILE_CompReader_t  CompReader;
+   
+   MEM_FILE_Diff_t  Diff;
+   MEM_FILE_Patch_t Patch;
+   MEM_FILE_Delta_t Delta;
+   uint32           IoBuf[MEM_FILE_IO_BLOCK_SIZE/sizeof(uint32)];  // Memory buffer for compares and compressed loads and dumps
    
 } MEM_FILE_Class_t;
 
@@ -111,13 +273,66 @@ typedef struct
 void MEM_FILE_Constructor(MEM_FILE_Class_t *MemFilePtr, const INITBL_Class_t *IniTbl);
 
 
+/******************************************************************************
+** Function: MEM_FILE_CompareCmd
+**
+** Compare memory with a load/dump file
+**
+** Notes:
+**   1. The file's secondary header defines the memory region. The region
+**      must be readable, it doesn't need to be writable.
+**   2. The file data is streamed against memory one block at a time and the
+**      file's CRC is verified in the same pass. Mismatches are only reported
+**      if the CRC is valid.
+**   3. The CompareTlm packet reports the number of differing bytes and the
+**      first differing address. If a diff filename is supplied the differing
+**      bytes are written to it as runs of (offset, expected, actual).
+**
+*/
+bool MEM_FILE_CompareCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr);
+
+
 /******************************************************************************
 ** Function: MEM_FILE_DumpCmd
 **
+** Notes:
+**   1. Compressed dumps compress each dump block independently, see
+**      mem_lz.h. Larger MEM_FILE_DUMP_BLOCK_SIZE values improve the
+**      compression ratio.
+**   2. Every dump of a region that fits in MEM_FILE_DELTA_MAX_BLOCKS blocks
+**      records the region's block CRCs. A delta dump only writes the blocks
+**      whose CRC differs from the region's last dump so the file size
+**      scales with the amount of change. A delta dump of a region without a
+**      recorded dump writes every block. See mem_mgr.xml DeltaFileHdr.
+**   3. The block CRCs are only recorded when the dump file is complete so
+**      a failed dump doesn't change the base of the next delta dump.
+**   4. A non-zero SegmentSize splits a full dump into numbered segment
+**      files of at most SegmentSize memory bytes in the same pass over
+**      memory. The segment number is inserted before the filename's
+**      extension, "dump.dat" is written as "dump_001.dat", "dump_002.dat",
+**      etc. Each segment is a complete load file for its part of the region.
+**      Segmented dumps don't record delta block CRCs.
+**
 */
 bool MEM_FILE_DumpCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr);
 
 
+/******************************************************************************
+** Function: MEM_FILE_DumpRegionsCmd
+**
+** Dump a list of memory regions to one file
+**
+** Notes:
+**   1. The file is a patch file with one record per region so the ground
+**      parses a single file and the LoadPatch command can restore the
+**      regions, provided the total fits in the load staging buffer.
+**   2. Every region is verified before the file is created. The regions are
+**      read in index order, they aren't captured as an atomic snapshot.
+**
+*/
+bool MEM_FILE_DumpRegionsCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr);
+
+
 /******************************************************************************
 ** Function: MEM_FILE_DumpSymTblCmd
 **
@@ -128,10 +343,35 @@ bool MEM_FILE_DumpSymTblCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr);
 /******************************************************************************
 ** Function: MEM_FILE_LoadCmd
 **
+** Notes:
+**   1. Compressed load files are decompressed one block at a time, see
+**      mem_lz.h. The file's CRC is defined over the decompressed data and
+**      memory is only written after the CRC is verified.
+**   2. A delta file's changed blocks are only written after the CRC of the
+**      image formed by the changed blocks and the current contents of the
+**      unchanged blocks matches the file's CRC. Loading a delta restores a
+**      region that still holds the delta's base image to the dumped image.
+**
 */
 bool MEM_FILE_LoadCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr);
 
 
+/******************************************************************************
+** Function: MEM_FILE_LoadPatchCmd
+**
+** Load the records in a patch file
+**
+** Notes:
+**   1. The file's index is read and every record's memory is verified. The
+**      record data is then staged and the CRC of the index and data is
+**      verified before any memory is written.
+**   2. The records are written in index order. If a write fails the
+**      remaining records aren't written.
+**
+*/
+bool MEM_FILE_LoadPatchCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr);
+
+
 /******************************************************************************
 ** Function:  MEM_FILE_ResetStatus
 **
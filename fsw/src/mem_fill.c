@@ -0,0 +1,375 @@
+/*
+**  Copyright 2022 bitValence, Inc.
+**  All Rights Reserved.
+**
+**  This program is free software; you can modify and/or redistribute it
+**  under the terms of the GNU Affero General Public License
+**  as published by the Free Software Foundation; version 3 with
+**  attribution addendums as found in the LICENSE.txt
+**
+**  This program is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU Affero General Public License for more details.
+**
+**  Purpose:
+**    Implement the memory pattern fill engine
+**
+**  Notes:
+**    1. Generated values are stored in the CPU's native byte order so a
+**       value reads back the same when it's peeked with the fill's memory
+**       size.
+**    2. A repeated pattern written to direct access RAM is generated once
+**       into a block that holds a whole number of patterns and the block is
+**       copied until the fill is complete.
+**    3. The PRBS is a 32-bit xorshift generator. It has a period of 2^32-1
+**       and the sequence is reproducible from the seed so filled memory can
+**       be verified with a RegionCrc command.
+**
+*/
+
+/*
+** Include Files:
+*/
+
+#include <string.h>
+#include "mem_fill.h"
+#include "memory.h"
+
+
+/*******************************/
+/** Local Function Prototypes **/
+/*******************************/
+
+static void   GenerateBlock(MEM_FILL_Pattern_t *Pattern, MEM_MGR_CpuAddr_Atom_t Addr, uint8 *Buf, uint32 ByteCnt);
+static uint16 GetElementLen(MEM_MGR_MemSize_Enum_t MemSize);
+static void   StoreElement(uint8 *Buf, uint16 ElementLen, uint32 Value);
+
+
+/******************************************************************************
+** Function: MEM_FILL_InitPattern
+**
+*/
+bool MEM_FILL_InitPattern(MEM_FILL_Pattern_t *Pattern, MEM_MGR_FillPattern_Enum_t Type,
+                          MEM_MGR_MemSize_Enum_t MemSize, const uint8 *Data, uint16 DataLen,
+                          uint32 Seed)
+{
+
+   bool RetStatus = false;
+
+   memset(Pattern, 0, sizeof(MEM_FILL_Pattern_t));
+
+   Pattern->Type       = Type;
+   Pattern->MemSize    = MemSize;
+   Pattern->ElementLen = GetElementLen(MemSize);
+   Pattern->Value      = Seed;
+
+   if (Pattern->ElementLen == 0)
+   {
+      CFE_EVS_SendEvent(MEM_FILL_INIT_PATTERN_EID, CFE_EVS_EventType_ERROR,
+                        "Fill pattern error: Invalid memory size %d", MemSize);
+   }
+   else
+   {
+
+      switch (Type)
+      {
+         case MEM_MGR_FillPattern_REPEAT:
+            if ((DataLen > 0) && (DataLen <= MEM_FILL_PATTERN_MAX_LEN) &&
+                ((DataLen % Pattern->ElementLen) == 0))
+            {
+               memcpy(Pattern->Data, Data, DataLen);
+               Pattern->DataLen = DataLen;
+               RetStatus = true;
+            }
+            else
+            {
+               CFE_EVS_SendEvent(MEM_FILL_INIT_PATTERN_EID, CFE_EVS_EventType_ERROR,
+                                 "Fill pattern error: Pattern length %d must be 1 to %d bytes and a multiple of the %d byte memory size",
+                                 DataLen, MEM_FILL_PATTERN_MAX_LEN, Pattern->ElementLen);
+            }
+            break;
+
+         case MEM_MGR_FillPattern_INCREMENT:
+         case MEM_MGR_FillPattern_ADDR:
+            RetStatus = true;
+            break;
+
+         case MEM_MGR_FillPattern_WALKING_ONES:
+            Pattern->Value = Seed % (Pattern->ElementLen * 8);
+            RetStatus = true;
+            break;
+
+         case MEM_MGR_FillPattern_PRBS:
+            if (Seed != 0)
+            {
+               RetStatus = true;
+            }
+            else
+            {
+               CFE_EVS_SendEvent(MEM_FILL_INIT_PATTERN_EID, CFE_EVS_EventType_ERROR,
+                                 "Fill pattern error: PRBS seed must be non-zero");
+            }
+            break;
+
+         default:
+            CFE_EVS_SendEvent(MEM_FILL_INIT_PATTERN_EID, CFE_EVS_EventType_ERROR,
+                              "Fill pattern error: Invalid pattern type %d", Type);
+            break;
+
+      } /* End pattern type switch */
+
+   } /* End if valid memory size */
+
+   return RetStatus;
+
+} /* End MEM_FILL_InitPattern() */
+
+
+/******************************************************************************
+** Function: MEM_FILL_InitValue
+**
+*/
+void MEM_FILL_InitValue(MEM_FILL_Pattern_t *Pattern, MEM_MGR_MemSize_Enum_t MemSize, uint32 Value)
+{
+
+   memset(Pattern, 0, sizeof(MEM_FILL_Pattern_t));
+
+   Pattern->Type       = MEM_MGR_FillPattern_REPEAT;
+   Pattern->MemSize    = MemSize;
+   Pattern->ElementLen = GetElementLen(MemSize);
+   Pattern->DataLen    = Pattern->ElementLen;
+
+   StoreElement(Pattern->Data, Pattern->ElementLen, Value);
+
+} /* End MEM_FILL_InitValue() */
+
+
+/******************************************************************************
+** Function: MEM_FILL_Write
+**
+** Notes:
+**   1. The block buffer is declared as uint64 so it's aligned for every
+**      memory size.
+**
+*/
+bool MEM_FILL_Write(MEM_FILL_Pattern_t *Pattern, MEM_MGR_CpuAddr_Atom_t DestAddr,
+                    uint32 ByteCnt, bool DirectAccess)
+{
+
+   bool    RetStatus = true;
+   uint64  BlockBuf[MEM_FILL_BLOCK_SIZE/8];
+   uint8  *Block = (uint8 *)BlockBuf;
+   uint32  BlockLen;
+   uint32  WriteLen;
+   uint16  StartOffset;
+
+   if ((Pattern->ElementLen == 0) || ((ByteCnt % Pattern->ElementLen) != 0))
+   {
+      CFE_EVS_SendEvent(MEM_FILL_WRITE_EID, CFE_EVS_EventType_ERROR,
+                        "Fill error: Byte count %u is not a multiple of the %d byte memory size",
+                        (unsigned int)ByteCnt, Pattern->ElementLen);
+      RetStatus = false;
+   }
+   else if (DirectAccess && (Pattern->Type == MEM_MGR_FillPattern_REPEAT))
+   {
+
+      StartOffset = Pattern->DataOffset;
+
+      if (Pattern->DataLen == 1)
+      {
+         memset((void *)DestAddr, Pattern->Data[0], ByteCnt);
+      }
+      else
+      {
+         BlockLen = (MEM_FILL_BLOCK_SIZE / Pattern->DataLen) * Pattern->DataLen;
+         GenerateBlock(Pattern, DestAddr, Block, BlockLen);
+
+         while (ByteCnt > 0)
+         {
+            WriteLen = (ByteCnt < BlockLen) ? ByteCnt : BlockLen;
+            memcpy((void *)DestAddr, Block, WriteLen);
+            DestAddr += WriteLen;
+            ByteCnt  -= WriteLen;
+            StartOffset = (StartOffset + WriteLen) % Pattern->DataLen;
+         }
+      }
+
+      Pattern->DataOffset = StartOffset;
+
+   } /* End if direct access repeat */
+   else
+   {
+
+      while (RetStatus && (ByteCnt > 0))
+      {
+         WriteLen = (ByteCnt < MEM_FILL_BLOCK_SIZE) ? ByteCnt : MEM_FILL_BLOCK_SIZE;
+         GenerateBlock(Pattern, DestAddr, Block, WriteLen);
+
+         if (DirectAccess)
+         {
+            memcpy((void *)DestAddr, Block, WriteLen);
+         }
+         else
+         {
+            // Event sent by MEM_SIZEx_WriteBlock()
+            RetStatus = MEMORY_WriteBlock(DestAddr, Pattern->MemSize, Block, WriteLen, false);
+         }
+         DestAddr += WriteLen;
+         ByteCnt  -= WriteLen;
+      }
+
+   } /* End if generated pattern or not direct access */
+
+   return RetStatus;
+
+} /* End MEM_FILL_Write() */
+
+
+/******************************************************************************
+** Function: GenerateBlock
+**
+** Notes:
+**   1. Addr is the memory address of Buf[0], it's only used by the ADDR
+**      pattern.
+**   2. ByteCnt must be a multiple of the pattern's element length.
+**
+*/
+static void GenerateBlock(MEM_FILL_Pattern_t *Pattern, MEM_MGR_CpuAddr_Atom_t Addr, uint8 *Buf, uint32 ByteCnt)
+{
+
+   uint32  i;
+   uint32  CopyLen;
+   uint32  Value      = Pattern->Value;
+   uint16  ElementLen = Pattern->ElementLen;
+   uint32  BitCnt     = ElementLen * 8;
+
+   switch (Pattern->Type)
+   {
+      case MEM_MGR_FillPattern_REPEAT:
+         for (i = 0; i < ByteCnt; i += CopyLen)
+         {
+            CopyLen = Pattern->DataLen - Pattern->DataOffset;
+            if (CopyLen > (ByteCnt - i))
+            {
+               CopyLen = ByteCnt - i;
+            }
+            memcpy(&Buf[i], &Pattern->Data[Pattern->DataOffset], CopyLen);
+            Pattern->DataOffset += CopyLen;
+            if (Pattern->DataOffset >= Pattern->DataLen)
+            {
+               Pattern->DataOffset = 0;
+            }
+         }
+         break;
+
+      case MEM_MGR_FillPattern_INCREMENT:
+         for (i = 0; i < ByteCnt; i += ElementLen)
+         {
+            StoreElement(&Buf[i], ElementLen, Value++);
+         }
+         break;
+
+      case MEM_MGR_FillPattern_ADDR:
+         for (i = 0; i < ByteCnt; i += ElementLen)
+         {
+            StoreElement(&Buf[i], ElementLen, (uint32)(Addr + i));
+         }
+         break;
+
+      case MEM_MGR_FillPattern_WALKING_ONES:
+         for (i = 0; i < ByteCnt; i += ElementLen)
+         {
+            StoreElement(&Buf[i], ElementLen, ((uint32)1 << Value));
+            if (++Value >= BitCnt)
+            {
+               Value = 0;
+            }
+         }
+         break;
+
+      case MEM_MGR_FillPattern_PRBS:
+         for (i = 0; i < ByteCnt; i += ElementLen)
+         {
+            Value ^= Value << 13;
+            Value ^= Value >> 17;
+            Value ^= Value << 5;
+            StoreElement(&Buf[i], ElementLen, Value);
+         }
+         break;
+
+      default:
+         memset(Buf, 0, ByteCnt);
+         break;
+
+   } /* End pattern type switch */
+
+   Pattern->Value = Value;
+
+} /* End GenerateBlock() */
+
+
+/******************************************************************************
+** Function: GetElementLen
+**
+** Notes:
+**   1. Returns 0 for an invalid memory size.
+**
+*/
+static uint16 GetElementLen(MEM_MGR_MemSize_Enum_t MemSize)
+{
+
+   uint16 ElementLen = 0;
+
+   switch (MemSize)
+   {
+      case MEM_MGR_MemSize_8:
+      case MEM_MGR_MemSize_VOID:
+         ElementLen = 1;
+         break;
+      case MEM_MGR_MemSize_16:
+         ElementLen = 2;
+         break;
+      case MEM_MGR_MemSize_32:
+         ElementLen = 4;
+         break;
+      default:
+         break;
+   }
+
+   return ElementLen;
+
+} /* End GetElementLen() */
+
+
+/******************************************************************************
+** Function: StoreElement
+**
+** Notes:
+**   1. Value is truncated to the element length.
+**
+*/
+static void StoreElement(uint8 *Buf, uint16 ElementLen, uint32 Value)
+{
+
+   uint8  Value8;
+   uint16 Value16;
+
+   switch (ElementLen)
+   {
+      case 1:
+         Value8 = (uint8)Value;
+         *Buf = Value8;
+         break;
+      case 2:
+         Value16 = (uint16)Value;
+         memcpy(Buf, &Value16, sizeof(Value16));
+         break;
+      case 4:
+         memcpy(Buf, &Value, sizeof(Value));
+         break;
+      default:
+         break;
+   }
+
+} /* End StoreElement() */
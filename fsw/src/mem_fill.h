@@ -0,0 +1,123 @@
+/*
+**  Copyright 2022 bitValence, Inc.
+**  All Rights Reserved.
+**
+**  This program is free software; you can modify and/or redistribute it
+**  under the terms of the GNU Affero General Public License
+**  as published by the Free Software Foundation; version 3 with
+**  attribution addendums as found in the LICENSE.txt
+**
+**  This program is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU Affero General Public License for more details.
+**
+**  Purpose:
+**    Define the memory pattern fill engine
+**
+**  Notes:
+**    1. A MEM_FILL_Pattern_t holds the state of a fill pattern generator. A
+**       fill can be performed with multiple MEM_FILL_Write() calls and the
+**       pattern continues where the previous call stopped.
+**    2. Patterns are generated in units of the fill's memory size so every
+**       memory location is written with one access of the commanded width.
+**    3. Direct access RAM is written with memcpy() from a generated block so
+**       the widest stores supported by the compiler and C library are used.
+**       All other memory uses MEMORY_WriteBlock()'s per-element PSP writes.
+**
+*/
+
+#ifndef _mem_fill_
+#define _mem_fill_
+
+/*
+** Includes
+*/
+
+#include "app_cfg.h"
+
+
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+
+/*
+** Event Message IDs
+*/
+
+#define MEM_FILL_INIT_PATTERN_EID  (MEM_FILL_BASE_EID + 0)
+#define MEM_FILL_WRITE_EID         (MEM_FILL_BASE_EID + 1)
+
+
+/**********************/
+/** Type Definitions **/
+/**********************/
+
+
+/******************************************************************************
+** Pattern generator
+*/
+
+typedef struct
+{
+
+   MEM_MGR_FillPattern_Enum_t  Type;
+   MEM_MGR_MemSize_Enum_t      MemSize;
+   uint16  ElementLen;    // Bytes per memory access, 1 for MEM_MGR_MemSize_VOID
+   uint16  DataLen;       // REPEAT pattern bytes
+   uint16  DataOffset;    // Next REPEAT pattern byte
+   uint32  Value;         // Next INCREMENT value, WALKING_ONES bit or PRBS state
+   uint8   Data[MEM_FILL_PATTERN_MAX_LEN];
+
+} MEM_FILL_Pattern_t;
+
+
+/************************/
+/** Exported Functions **/
+/************************/
+
+
+/******************************************************************************
+** Function: MEM_FILL_InitPattern
+**
+** Notes:
+**   1. Data and DataLen are only used by the REPEAT pattern. DataLen must be
+**      a multiple of the memory size so each element is written with a
+**      single access.
+**   2. Seed is the first INCREMENT value, the first WALKING_ONES bit number
+**      and the initial PRBS state. A PRBS seed can't be zero.
+**   3. Error events are sent for invalid parameters.
+**
+*/
+bool MEM_FILL_InitPattern(MEM_FILL_Pattern_t *Pattern, MEM_MGR_FillPattern_Enum_t Type,
+                          MEM_MGR_MemSize_Enum_t MemSize, const uint8 *Data, uint16 DataLen,
+                          uint32 Seed);
+
+
+/******************************************************************************
+** Function: MEM_FILL_InitValue
+**
+** Notes:
+**   1. Initialize a REPEAT pattern that fills each element with Value. This
+**      is the pattern used by the original single value Fill command.
+**
+*/
+void MEM_FILL_InitValue(MEM_FILL_Pattern_t *Pattern, MEM_MGR_MemSize_Enum_t MemSize, uint32 Value);
+
+
+/******************************************************************************
+** Function: MEM_FILL_Write
+**
+** Notes:
+**   1. The address must be verified by MEMORY_VerifyAddr() prior to calling
+**      this function and DirectAccess should be set to its DirectAccess
+**      result.
+**   2. ByteCnt must be a multiple of the pattern's element length.
+**
+*/
+bool MEM_FILL_Write(MEM_FILL_Pattern_t *Pattern, MEM_MGR_CpuAddr_Atom_t DestAddr,
+                    uint32 ByteCnt, bool DirectAccess);
+
+
+#endif /* _mem_fill_ */
@@ -0,0 +1,243 @@
+/*
+**  Copyright 2022 bitValence, Inc.
+**  All Rights Reserved.
+**
+**  This program is free software; you can modify and/or redistribute it
+**  under the terms of the GNU Affero General Public License
+**  as published by the Free Software Foundation; version 3 with
+**  attribution addendums as found in the LICENSE.txt
+**
+**  This program is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU Affero General Public License for more details.
+**
+**  Purpose:
+**    Implement the memory region hash tree
+**
+**  Notes:
+**    1. The upper levels hash at most LeafCnt/(Fanout-1) nodes of Fanout
+**       hashes each so their cost is small compared to the leaf hashes.
+**
+*/
+
+/*
+** Include Files:
+*/
+
+#include <string.h>
+#include "mem_hash_tree.h"
+#include "mem_crc.h"
+
+
+/*******************************/
+/** Local Function Prototypes **/
+/*******************************/
+
+static uint32 HashChildren(const MEM_HASH_TREE_Tree_t *Tree, const uint32 *Child, uint32 ChildCnt);
+
+
+/******************************************************************************
+** Function: MEM_HASH_TREE_ComputeLevels
+**
+** Notes:
+**   1. Levels are computed from the level above the leaves up to the root.
+**
+*/
+void MEM_HASH_TREE_ComputeLevels(MEM_HASH_TREE_Tree_t *Tree)
+{
+
+   uint8   Level;
+   uint32  i;
+   uint32  FirstChild;
+   uint32  ChildCnt;
+
+   for (Level = Tree->LevelCnt - 1; Level > 0; Level--)
+   {
+      for (i=0; i < Tree->LevelNodeCnt[Level-1]; i++)
+      {
+         FirstChild = i * Tree->Fanout;
+         ChildCnt   = Tree->LevelNodeCnt[Level] - FirstChild;
+         if (ChildCnt > Tree->Fanout)
+         {
+            ChildCnt = Tree->Fanout;
+         }
+         Tree->Node[Tree->LevelStart[Level-1] + i] =
+            HashChildren(Tree, &Tree->Node[Tree->LevelStart[Level] + FirstChild], ChildCnt);
+      }
+   }
+
+   Tree->Valid = true;
+
+} /* End MEM_HASH_TREE_ComputeLevels() */
+
+
+/******************************************************************************
+** Function: MEM_HASH_TREE_GetNodes
+**
+*/
+const uint32 *MEM_HASH_TREE_GetNodes(const MEM_HASH_TREE_Tree_t *Tree, uint8 Level,
+                                     uint32 StartNode, uint16 *NodeCnt)
+{
+
+   const uint32 *Nodes = NULL;
+
+   if (Tree->Valid && (Level < Tree->LevelCnt) && (StartNode < Tree->LevelNodeCnt[Level]))
+   {
+      if (*NodeCnt > (Tree->LevelNodeCnt[Level] - StartNode))
+      {
+         *NodeCnt = (uint16)(Tree->LevelNodeCnt[Level] - StartNode);
+      }
+      Nodes = &Tree->Node[Tree->LevelStart[Level] + StartNode];
+   }
+
+   return Nodes;
+
+} /* End MEM_HASH_TREE_GetNodes() */
+
+
+/******************************************************************************
+** Function: MEM_HASH_TREE_Init
+**
+** Notes:
+**   1. The level sizes are computed from the leaves up and then stored root
+**      first.
+**
+*/
+bool MEM_HASH_TREE_Init(MEM_HASH_TREE_Tree_t *Tree, MEM_MGR_CpuAddr_Atom_t StartAddr, uint32 ByteCnt,
+                        uint32 LeafSize, uint16 Fanout, MEM_MGR_CrcType_Enum_t CrcType)
+{
+
+   bool    RetStatus = false;
+   uint8   LevelCnt = 0;
+   uint8   Level;
+   uint32  LeafCnt;
+   uint32  NodeCnt;
+   uint32  NodeIdx = 0;
+   uint32  LevelNodeCnt[MEM_HASH_TREE_MAX_LEVELS];
+
+   Tree->Valid = false;
+
+   if ((ByteCnt == 0) || (LeafSize == 0))
+   {
+      CFE_EVS_SendEvent(MEM_HASH_TREE_INIT_EID, CFE_EVS_EventType_ERROR,
+                        "Hash tree error: Byte count %u and leaf size %u must be non-zero",
+                        (unsigned int)ByteCnt, (unsigned int)LeafSize);
+   }
+   else if ((Fanout < 2) || (Fanout > MEM_HASH_TREE_MAX_FANOUT))
+   {
+      CFE_EVS_SendEvent(MEM_HASH_TREE_INIT_EID, CFE_EVS_EventType_ERROR,
+                        "Hash tree error: Fanout %d must be 2 to %d",
+                        Fanout, MEM_HASH_TREE_MAX_FANOUT);
+   }
+   else if (!MEM_CRC_ValidType(CrcType))
+   {
+      CFE_EVS_SendEvent(MEM_HASH_TREE_INIT_EID, CFE_EVS_EventType_ERROR,
+                        "Hash tree error: Invalid CRC type %d. See mem_mgr.xml CrcType for valid types.",
+                        CrcType);
+   }
+   else
+   {
+
+      LeafCnt = (ByteCnt / LeafSize) + (((ByteCnt % LeafSize) != 0) ? 1 : 0);
+
+      NodeCnt = LeafCnt;
+      LevelNodeCnt[LevelCnt++] = NodeCnt;
+      while ((NodeCnt > 1) && (LevelCnt < MEM_HASH_TREE_MAX_LEVELS))
+      {
+         NodeCnt = (NodeCnt + Fanout - 1) / Fanout;
+         LevelNodeCnt[LevelCnt++] = NodeCnt;
+      }
+
+      if ((LeafCnt > MEM_HASH_TREE_MAX_LEAVES) || (NodeCnt > 1))
+      {
+         CFE_EVS_SendEvent(MEM_HASH_TREE_INIT_EID, CFE_EVS_EventType_ERROR,
+                           "Hash tree error: %u byte region with %u byte leaves has %u leaves, the maximum is %u",
+                           (unsigned int)ByteCnt, (unsigned int)LeafSize, (unsigned int)LeafCnt,
+                           (unsigned int)MEM_HASH_TREE_MAX_LEAVES);
+      }
+      else
+      {
+         memset(Tree, 0, sizeof(MEM_HASH_TREE_Tree_t));
+
+         Tree->LevelCnt  = LevelCnt;
+         Tree->Fanout    = Fanout;
+         Tree->LeafSize  = LeafSize;
+         Tree->ByteCnt   = ByteCnt;
+         Tree->StartAddr = StartAddr;
+         Tree->CrcType   = CrcType;
+
+         for (Level=0; Level < LevelCnt; Level++)
+         {
+            Tree->LevelStart[Level]   = NodeIdx;
+            Tree->LevelNodeCnt[Level] = LevelNodeCnt[LevelCnt - 1 - Level];
+            NodeIdx += Tree->LevelNodeCnt[Level];
+         }
+
+         RetStatus = true;
+      }
+
+   } /* End if valid parameters */
+
+   return RetStatus;
+
+} /* End MEM_HASH_TREE_Init() */
+
+
+/******************************************************************************
+** Function: MEM_HASH_TREE_LeafCnt
+**
+*/
+uint32 MEM_HASH_TREE_LeafCnt(const MEM_HASH_TREE_Tree_t *Tree)
+{
+
+   return (Tree->LevelCnt == 0) ? 0 : Tree->LevelNodeCnt[Tree->LevelCnt - 1];
+
+} /* End MEM_HASH_TREE_LeafCnt() */
+
+
+/******************************************************************************
+** Function: MEM_HASH_TREE_SetLeaf
+**
+** Notes:
+**   1. Leaves beyond the tree's leaf count are ignored.
+**
+*/
+void MEM_HASH_TREE_SetLeaf(MEM_HASH_TREE_Tree_t *Tree, uint32 Leaf, uint32 Hash)
+{
+
+   if (Leaf < MEM_HASH_TREE_LeafCnt(Tree))
+   {
+      Tree->Node[Tree->LevelStart[Tree->LevelCnt - 1] + Leaf] = Hash;
+   }
+
+} /* End MEM_HASH_TREE_SetLeaf() */
+
+
+/******************************************************************************
+** Function: HashChildren
+**
+** Notes:
+**   1. The child hashes are serialized most significant byte first so the
+**      ground computes the same node hashes regardless of the CPU's byte
+**      order.
+**
+*/
+static uint32 HashChildren(const MEM_HASH_TREE_Tree_t *Tree, const uint32 *Child, uint32 ChildCnt)
+{
+
+   uint8   Buf[4 * MEM_HASH_TREE_MAX_FANOUT];
+   uint8  *BufPtr = Buf;
+   uint32  i;
+
+   for (i=0; i < ChildCnt; i++)
+   {
+      *BufPtr++ = (uint8)(Child[i] >> 24);
+      *BufPtr++ = (uint8)(Child[i] >> 16);
+      *BufPtr++ = (uint8)(Child[i] >> 8);
+      *BufPtr++ = (uint8)(Child[i]);
+   }
+
+   return MEM_CRC_Calculate(Buf, 4 * ChildCnt, 0, Tree->CrcType);
+
+} /* End HashChildren() */
@@ -0,0 +1,148 @@
+/*
+**  Copyright 2022 bitValence, Inc.
+**  All Rights Reserved.
+**
+**  This program is free software; you can modify and/or redistribute it
+**  under the terms of the GNU Affero General Public License
+**  as published by the Free Software Foundation; version 3 with
+**  attribution addendums as found in the LICENSE.txt
+**
+**  This program is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU Affero General Public License for more details.
+**
+**  Purpose:
+**    Define the memory region hash tree
+**
+**  Notes:
+**    1. A hash tree summarizes a memory region so the ground can locate the
+**       parts that differ from a reference image by comparing hashes one
+**       tree level at a time instead of dumping the region.
+**    2. Level 0 is the root and level LevelCnt-1 holds the leaves. Leaf i is
+**       the CRC of region bytes i*LeafSize up to (i+1)*LeafSize, the last
+**       leaf may be shorter. Node i of an upper level is the CRC of nodes
+**       i*Fanout up to (i+1)*Fanout of the level below, each child hash
+**       taken as 4 bytes with the most significant byte first.
+**    3. The caller computes the leaf hashes from memory. The engine only
+**       defines the tree layout and computes the upper levels.
+**
+*/
+
+#ifndef _mem_hash_tree_
+#define _mem_hash_tree_
+
+/*
+** Includes
+*/
+
+#include "app_cfg.h"
+
+
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+#define MEM_HASH_TREE_MAX_LEVELS  24
+
+/* Bounds the node count of a tree with the minimum fanout of 2 */
+#define MEM_HASH_TREE_MAX_NODES   (2 * MEM_HASH_TREE_MAX_LEAVES + MEM_HASH_TREE_MAX_LEVELS)
+
+
+/*
+** Event Message IDs
+*/
+
+#define MEM_HASH_TREE_INIT_EID  (MEM_HASH_TREE_BASE_EID + 0)
+
+
+/**********************/
+/** Type Definitions **/
+/**********************/
+
+
+/******************************************************************************
+** Memory region hash tree
+**
+** Levels are stored root first so LevelStart[0] is always 0. Valid is only
+** true after every node has been computed.
+*/
+
+typedef struct
+{
+
+   bool    Valid;
+   uint8   LevelCnt;
+   uint16  Fanout;
+   uint32  LeafSize;
+   uint32  ByteCnt;
+   MEM_MGR_CpuAddr_Atom_t  StartAddr;
+   MEM_MGR_CrcType_Enum_t  CrcType;
+
+   uint32  LevelStart[MEM_HASH_TREE_MAX_LEVELS];     // Node index of each level's first node
+   uint32  LevelNodeCnt[MEM_HASH_TREE_MAX_LEVELS];
+   uint32  Node[MEM_HASH_TREE_MAX_NODES];
+
+} MEM_HASH_TREE_Tree_t;
+
+
+/************************/
+/** Exported Functions **/
+/************************/
+
+
+/******************************************************************************
+** Function: MEM_HASH_TREE_ComputeLevels
+**
+** Notes:
+**   1. Compute every node above the leaves and mark the tree valid. All of
+**      the leaves must have been set with MEM_HASH_TREE_SetLeaf().
+**
+*/
+void MEM_HASH_TREE_ComputeLevels(MEM_HASH_TREE_Tree_t *Tree);
+
+
+/******************************************************************************
+** Function: MEM_HASH_TREE_GetNodes
+**
+** Notes:
+**   1. Return a pointer to a level's hashes starting at StartNode and limit
+**      *NodeCnt to the nodes remaining in the level. NULL is returned if the
+**      tree isn't valid, Level doesn't exist or StartNode is past the end of
+**      the level.
+**
+*/
+const uint32 *MEM_HASH_TREE_GetNodes(const MEM_HASH_TREE_Tree_t *Tree, uint8 Level,
+                                     uint32 StartNode, uint16 *NodeCnt);
+
+
+/******************************************************************************
+** Function: MEM_HASH_TREE_Init
+**
+** Notes:
+**   1. Define the tree layout for a ByteCnt byte region. The previous tree
+**      is always invalidated, including when error events are sent for
+**      invalid parameters.
+**   2. Fanout must be 2 to MEM_HASH_TREE_MAX_FANOUT and the region can't
+**      have more than MEM_HASH_TREE_MAX_LEAVES leaves.
+**
+*/
+bool MEM_HASH_TREE_Init(MEM_HASH_TREE_Tree_t *Tree, MEM_MGR_CpuAddr_Atom_t StartAddr, uint32 ByteCnt,
+                        uint32 LeafSize, uint16 Fanout, MEM_MGR_CrcType_Enum_t CrcType);
+
+
+/******************************************************************************
+** Function: MEM_HASH_TREE_LeafCnt
+**
+*/
+uint32 MEM_HASH_TREE_LeafCnt(const MEM_HASH_TREE_Tree_t *Tree);
+
+
+/******************************************************************************
+** Function: MEM_HASH_TREE_SetLeaf
+**
+*/
+void MEM_HASH_TREE_SetLeaf(MEM_HASH_TREE_Tree_t *Tree, uint32 Leaf, uint32 Hash);
+
+
+#endif /* _mem_hash_tree_ */
@@ -0,0 +1,338 @@
+/*
+**  Copyright 2022 bitValence, Inc.
+**  All Rights Reserved.
+**
+**  This program is free software; you can modify and/or redistribute it
+**  under the terms of the GNU Affero General Public License
+**  as published by the Free Software Foundation; version 3 with
+**  attribution addendums as found in the LICENSE.txt
+**
+**  This program is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU Affero General Public License for more details.
+**
+**  Purpose:
+**    Implement the memory block LZ compression engine
+**
+**  Notes:
+**    1. The compressor is a single pass greedy matcher. Each position's
+**       4 byte value is hashed and the table's previous position with the
+**       same hash is the only match candidate.
+**    2. Positions that don't match are skipped faster the longer the
+**       current literal run is so incompressible data is passed over
+**       quickly.
+**
+*/
+
+/*
+** Include Files:
+*/
+
+#include <string.h>
+#include "mem_lz.h"
+
+
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+#define TOKEN_MAX_LEN  15
+#define SKIP_SHIFT     6
+
+#define HASH(Value)  ((uint32)((Value) * 2654435761U) >> (32 - MEM_LZ_HASH_BITS))
+
+
+/*******************************/
+/** Local Function Prototypes **/
+/*******************************/
+
+static bool   EmitSequence(uint8 *Dest, uint32 DestMax, uint32 *DestLen, const uint8 *Literals,
+                           uint32 LiteralLen, uint32 Offset, uint32 MatchLen);
+static bool   GetLength(const uint8 **Src, const uint8 *SrcEnd, uint32 *Len);
+static uint8 *PutLength(uint8 *Dest, uint32 Len);
+static uint32 Read32(const uint8 *Src);
+
+
+/******************************************************************************
+** Function: MEM_LZ_Compress
+**
+*/
+uint32 MEM_LZ_Compress(MEM_LZ_Arena_t *Arena, const uint8 *Src, uint32 SrcLen,
+                       uint8 *Dest, uint32 DestMax)
+{
+
+   bool    Valid  = (SrcLen <= MEM_LZ_MAX_BLOCK_LEN);
+   uint32  Pos    = 0;
+   uint32  Anchor = 0;
+   uint32  Ref;
+   uint32  Hash;
+   uint32  MatchLen;
+   uint32  DestLen = 0;
+
+   while (Valid && ((Pos + MEM_LZ_MIN_MATCH) <= SrcLen))
+   {
+
+      Hash = HASH(Read32(&Src[Pos]));
+      Ref  = Arena->HashTbl[Hash];
+      Arena->HashTbl[Hash] = (uint16)Pos;
+
+      if ((Ref < Pos) && (Read32(&Src[Ref]) == Read32(&Src[Pos])))
+      {
+         MatchLen = MEM_LZ_MIN_MATCH;
+         while (((Pos + MatchLen + 4) <= SrcLen) && (Read32(&Src[Ref + MatchLen]) == Read32(&Src[Pos + MatchLen])))
+         {
+            MatchLen += 4;
+         }
+         while (((Pos + MatchLen) < SrcLen) && (Src[Ref + MatchLen] == Src[Pos + MatchLen]))
+         {
+            MatchLen++;
+         }
+
+         Valid  = EmitSequence(Dest, DestMax, &DestLen, &Src[Anchor], Pos - Anchor, Pos - Ref, MatchLen);
+         Pos   += MatchLen;
+         Anchor = Pos;
+      }
+      else
+      {
+         Pos += 1 + ((Pos - Anchor) >> SKIP_SHIFT);
+      }
+
+   } /* End while positions */
+
+   if (Valid)
+   {
+      Valid = EmitSequence(Dest, DestMax, &DestLen, &Src[Anchor], SrcLen - Anchor, 0, 0);
+   }
+
+   return (Valid ? DestLen : 0);
+
+} /* End MEM_LZ_Compress() */
+
+
+/******************************************************************************
+** Function: MEM_LZ_Decompress
+**
+** Notes:
+**   1. Matches are copied one byte at a time when they overlap the bytes
+**      they produce.
+**
+*/
+uint32 MEM_LZ_Decompress(const uint8 *Src, uint32 SrcLen, uint8 *Dest, uint32 DestMax)
+{
+
+   const uint8 *SrcEnd = &Src[SrcLen];
+   bool    Valid = true;
+   bool    Done  = false;
+   uint8   Token;
+   uint32  Len;
+   uint32  Offset = 0;
+   uint32  DestLen = 0;
+
+   while (Valid && !Done && (Src < SrcEnd))
+   {
+
+      Token = *Src++;
+
+      Len = Token >> 4;
+      if (Len == TOKEN_MAX_LEN)
+      {
+         Valid = GetLength(&Src, SrcEnd, &Len);
+      }
+      if (Valid)
+      {
+         Valid = (Len <= (uint32)(SrcEnd - Src)) && (Len <= (DestMax - DestLen));
+      }
+      if (Valid)
+      {
+         memcpy(&Dest[DestLen], Src, Len);
+         Src     += Len;
+         DestLen += Len;
+
+         if (Src == SrcEnd)
+         {
+            Done = true;   /* Final literal only sequence */
+         }
+         else if ((SrcEnd - Src) < 2)
+         {
+            Valid = false;
+         }
+         else
+         {
+            Offset = Src[0] | ((uint32)Src[1] << 8);
+            Src += 2;
+            Len = Token & 0x0F;
+            if (Len == TOKEN_MAX_LEN)
+            {
+               Valid = GetLength(&Src, SrcEnd, &Len);
+            }
+         }
+      } /* End if valid literals */
+
+      if (Valid && !Done)
+      {
+         Len += MEM_LZ_MIN_MATCH;
+         Valid = (Offset != 0) && (Offset <= DestLen) && (Len <= (DestMax - DestLen));
+         if (Valid)
+         {
+            if (Offset >= Len)
+            {
+               memcpy(&Dest[DestLen], &Dest[DestLen - Offset], Len);
+               DestLen += Len;
+            }
+            else
+            {
+               while (Len-- > 0)
+               {
+                  Dest[DestLen] = Dest[DestLen - Offset];
+                  DestLen++;
+               }
+            }
+         }
+      } /* End if match */
+
+   } /* End while sequences */
+
+   return (Valid ? DestLen : 0);
+
+} /* End MEM_LZ_Decompress() */
+
+
+/******************************************************************************
+** Function: MEM_LZ_InitArena
+**
+*/
+void MEM_LZ_InitArena(MEM_LZ_Arena_t *Arena)
+{
+
+   memset(Arena, 0, sizeof(MEM_LZ_Arena_t));
+
+} /* End MEM_LZ_InitArena() */
+
+
+/******************************************************************************
+** Function: EmitSequence
+**
+** Notes:
+**   1. A MatchLen of zero emits the block's final literal only sequence.
+**   2. The space check uses the worst case length encoding so the sequence
+**      is never partially written.
+**
+*/
+static bool EmitSequence(uint8 *Dest, uint32 DestMax, uint32 *DestLen, const uint8 *Literals,
+                         uint32 LiteralLen, uint32 Offset, uint32 MatchLen)
+{
+
+   bool    RetStatus = false;
+   uint8  *Out = &Dest[*DestLen];
+   uint8  *Token;
+   uint32  MaxLen = 1 + (LiteralLen / 255 + 1) + LiteralLen;
+
+   if (MatchLen != 0)
+   {
+      MaxLen += 2 + ((MatchLen - MEM_LZ_MIN_MATCH) / 255 + 1);
+   }
+
+   if ((*DestLen + MaxLen) <= DestMax)
+   {
+
+      Token  = Out++;
+      *Token = (uint8)(((LiteralLen < TOKEN_MAX_LEN) ? LiteralLen : TOKEN_MAX_LEN) << 4);
+      if (LiteralLen >= TOKEN_MAX_LEN)
+      {
+         Out = PutLength(Out, LiteralLen - TOKEN_MAX_LEN);
+      }
+      memcpy(Out, Literals, LiteralLen);
+      Out += LiteralLen;
+
+      if (MatchLen != 0)
+      {
+         MatchLen -= MEM_LZ_MIN_MATCH;
+         *Token |= (uint8)((MatchLen < TOKEN_MAX_LEN) ? MatchLen : TOKEN_MAX_LEN);
+         *Out++ = (uint8)(Offset & 0xFF);
+         *Out++ = (uint8)(Offset >> 8);
+         if (MatchLen >= TOKEN_MAX_LEN)
+         {
+            Out = PutLength(Out, MatchLen - TOKEN_MAX_LEN);
+         }
+      }
+
+      *DestLen = (uint32)(Out - Dest);
+      RetStatus = true;
+
+   } /* End if room for sequence */
+
+   return RetStatus;
+
+} /* End EmitSequence() */
+
+
+/******************************************************************************
+** Function: GetLength
+**
+** Notes:
+**   1. Add a length's extension bytes to Len and advance Src past them.
+**      Returns false if the extension bytes run past the end of the block.
+**
+*/
+static bool GetLength(const uint8 **Src, const uint8 *SrcEnd, uint32 *Len)
+{
+
+   bool  RetStatus = true;
+   uint8 LenByte   = 255;
+
+   while (RetStatus && (LenByte == 255))
+   {
+      if (*Src < SrcEnd)
+      {
+         LenByte = *(*Src)++;
+         *Len += LenByte;
+      }
+      else
+      {
+         RetStatus = false;
+      }
+   }
+
+   return RetStatus;
+
+} /* End GetLength() */
+
+
+/******************************************************************************
+** Function: PutLength
+**
+** Notes:
+**   1. Write the extension bytes of a length that didn't fit in a token
+**      nibble and return the next output location.
+**
+*/
+static uint8 *PutLength(uint8 *Dest, uint32 Len)
+{
+
+   while (Len >= 255)
+   {
+      *Dest++ = 255;
+      Len -= 255;
+   }
+   *Dest++ = (uint8)Len;
+
+   return Dest;
+
+} /* End PutLength() */
+
+
+/******************************************************************************
+** Function: Read32
+**
+*/
+static uint32 Read32(const uint8 *Src)
+{
+
+   uint32 Value;
+
+   memcpy(&Value, Src, sizeof(Value));
+
+   return Value;
+
+} /* End Read32() */
@@ -0,0 +1,116 @@
+/*
+**  Copyright 2022 bitValence, Inc.
+**  All Rights Reserved.
+**
+**  This program is free software; you can modify and/or redistribute it
+**  under the terms of the GNU Affero General Public License
+**  as published by the Free Software Foundation; version 3 with
+**  attribution addendums as found in the LICENSE.txt
+**
+**  This program is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU Affero General Public License for more details.
+**
+**  Purpose:
+**    Define the memory block LZ compression engine
+**
+**  Notes:
+**    1. Each block is compressed independently so a compressed file can be
+**       decompressed one block at a time without a history buffer.
+**    2. A compressed block is a sequence of LZ4 style sequences. Each
+**       sequence starts with a token byte. The token's upper nibble is the
+**       literal length and the lower nibble is the match length minus
+**       MEM_LZ_MIN_MATCH. A nibble value of 15 is followed by length bytes
+**       that are added to it until a byte less than 255. The literals follow
+**       the literal length and a match is defined by a 2 byte little endian
+**       offset followed by the match length bytes.
+**    3. The last sequence of a block only has literals and it may have zero
+**       literals. Matches can overlap the bytes they produce so runs of a
+**       repeated byte or word compress to a few bytes.
+**    4. The compressor's only working memory is the caller's arena. Stale
+**       hash table entries are verified before they're used so the table
+**       doesn't need to be cleared between blocks.
+**    5. The decompressor doesn't use any working memory, a block is
+**       decompressed directly into the caller's output buffer.
+**
+*/
+
+#ifndef _mem_lz_
+#define _mem_lz_
+
+/*
+** Includes
+*/
+
+#include "app_cfg.h"
+
+
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+#define MEM_LZ_HASH_BITS      12
+#define MEM_LZ_MIN_MATCH      4
+#define MEM_LZ_MAX_BLOCK_LEN  0xFFFF   // Positions are stored in 16 bits
+
+
+/**********************/
+/** Type Definitions **/
+/**********************/
+
+
+/******************************************************************************
+** Compressor working memory
+*/
+
+typedef struct
+{
+
+   uint16  HashTbl[1 << MEM_LZ_HASH_BITS];   // Last block position of each hashed 4 byte value
+
+} MEM_LZ_Arena_t;
+
+
+/************************/
+/** Exported Functions **/
+/************************/
+
+
+/******************************************************************************
+** Function: MEM_LZ_Compress
+**
+** Notes:
+**   1. Compress SrcLen bytes into Dest and return the compressed length.
+**      Zero is returned if the compressed block would be longer than
+**      DestMax bytes or SrcLen exceeds MEM_LZ_MAX_BLOCK_LEN. Callers store
+**      the block uncompressed when zero is returned.
+**   2. Src must be RAM, it's read with unaligned 32-bit loads.
+**
+*/
+uint32 MEM_LZ_Compress(MEM_LZ_Arena_t *Arena, const uint8 *Src, uint32 SrcLen,
+                       uint8 *Dest, uint32 DestMax);
+
+
+/******************************************************************************
+** Function: MEM_LZ_Decompress
+**
+** Notes:
+**   1. Decompress a SrcLen byte block into Dest and return the decompressed
+**      length. Zero is returned if the block is malformed or decompresses
+**      to more than DestMax bytes.
+**   2. Every length and match offset is checked against the block and Dest
+**      bounds so a corrupted block can't read or write outside the buffers.
+**
+*/
+uint32 MEM_LZ_Decompress(const uint8 *Src, uint32 SrcLen, uint8 *Dest, uint32 DestMax);
+
+
+/******************************************************************************
+** Function: MEM_LZ_InitArena
+**
+*/
+void MEM_LZ_InitArena(MEM_LZ_Arena_t *Arena);
+
+
+#endif /* _mem_lz_ */
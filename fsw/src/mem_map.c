@@ -0,0 +1,553 @@
+/*
+**  Copyright 2022 bitValence, Inc.
+**  All Rights Reserved.
+**
+**  This program is free software; you can modify and/or redistribute it
+**  under the terms of the GNU Affero General Public License
+**  as published by the Free Software Foundation; version 3 with
+**  attribution addendums as found in the LICENSE.txt
+**
+**  This program is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU Affero General Public License for more details.
+**
+**  Purpose:
+**    Implement the MEM_MAP_Class methods
+**
+**  Notes:
+**    1. JSON values are loaded into a staging array of strings and numbers.
+**       Addresses are hex strings because JSON numbers can't represent all
+**       64-bit addresses. The staged regions are converted, validated and
+**       sorted before they replace the current map.
+**
+*/
+
+/*
+** Include Files:
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mem_map.h"
+
+
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+#define JSON_REGION_OBJS  6   // JSON objects per region
+
+
+/**********************/
+/** Type Definitions **/
+/**********************/
+
+typedef struct
+{
+
+   char   Name[OS_MAX_API_NAME];
+   char   StartAddr[MEM_MAP_JSON_ADDR_STR_LEN];
+   uint32 ByteCnt;
+   char   MemType[MEM_MAP_JSON_ATTR_STR_LEN];
+   char   MemSizes[MEM_MAP_JSON_ATTR_STR_LEN];
+   char   Access[MEM_MAP_JSON_ATTR_STR_LEN];
+
+} JsonRegion_t;
+
+
+/*******************************/
+/** Local Function Prototypes **/
+/*******************************/
+
+static bool ConvertRegion(const JsonRegion_t *JsonRegion, MEM_MAP_Region_t *Region);
+static const MEM_MAP_Region_t *FindRegion(cpuaddr CpuAddr);
+static bool LoadJsonData(size_t JsonFileLen);
+static bool SortRegions(MEM_MAP_Data_t *Data);
+
+
+/**********************/
+/** Global File Data **/
+/**********************/
+
+static MEM_MAP_Class_t *MemMap = NULL;
+
+static MEM_MAP_Data_t  TblData;    // Working buffer for loads
+static JsonRegion_t    JsonRegion[MEM_MGR_MEM_MAP_MAX_REGIONS];
+static CJSON_Obj_t     JsonTblObjs[MEM_MGR_MEM_MAP_MAX_REGIONS * JSON_REGION_OBJS];
+
+static const char *MemTypeStr[] = { "UNDEF", "UNDEF", "RAM", "NONVOL" };
+
+
+/******************************************************************************
+** Function: MEM_MAP_Constructor
+**
+*/
+void MEM_MAP_Constructor(MEM_MAP_Class_t *MemMapPtr)
+{
+
+   int32  Status;
+   uint32 i;
+   char   QueryKey[CJSON_MAX_KEY_LEN];
+   CJSON_Obj_t *Obj = JsonTblObjs;
+
+   MemMap = MemMapPtr;
+
+   CFE_PSP_MemSet((void*)MemMap, 0, sizeof(MEM_MAP_Class_t));
+
+   Status = OS_MutSemCreate(&MemMap->MutexId, "MEM_MGR_MEM_MAP", 0);
+   if (Status == OS_SUCCESS)
+   {
+      MemMap->MutexCreated = true;
+   }
+   else
+   {
+      CFE_EVS_SendEvent(MEM_MAP_CONSTRUCTOR_EID, CFE_EVS_EventType_ERROR,
+                        "Error creating memory map mutex, status=%d. Memory map loads will be rejected",
+                        (int)Status);
+   }
+
+   for (i=0; i < MEM_MGR_MEM_MAP_MAX_REGIONS; i++)
+   {
+      snprintf(QueryKey, sizeof(QueryKey), "region[%u].name", (unsigned int)i);
+      CJSON_ObjConstructor(Obj++, QueryKey, JSONString, JsonRegion[i].Name, sizeof(JsonRegion[i].Name));
+      snprintf(QueryKey, sizeof(QueryKey), "region[%u].start-addr", (unsigned int)i);
+      CJSON_ObjConstructor(Obj++, QueryKey, JSONString, JsonRegion[i].StartAddr, sizeof(JsonRegion[i].StartAddr));
+      snprintf(QueryKey, sizeof(QueryKey), "region[%u].byte-cnt", (unsigned int)i);
+      CJSON_ObjConstructor(Obj++, QueryKey, JSONNumber, &JsonRegion[i].ByteCnt, sizeof(JsonRegion[i].ByteCnt));
+      snprintf(QueryKey, sizeof(QueryKey), "region[%u].mem-type", (unsigned int)i);
+      CJSON_ObjConstructor(Obj++, QueryKey, JSONString, JsonRegion[i].MemType, sizeof(JsonRegion[i].MemType));
+      snprintf(QueryKey, sizeof(QueryKey), "region[%u].mem-sizes", (unsigned int)i);
+      CJSON_ObjConstructor(Obj++, QueryKey, JSONString, JsonRegion[i].MemSizes, sizeof(JsonRegion[i].MemSizes));
+      snprintf(QueryKey, sizeof(QueryKey), "region[%u].access", (unsigned int)i);
+      CJSON_ObjConstructor(Obj++, QueryKey, JSONString, JsonRegion[i].Access, sizeof(JsonRegion[i].Access));
+   }
+
+} /* End MEM_MAP_Constructor() */
+
+
+/******************************************************************************
+** Function: MEM_MAP_DumpCmd
+**
+** Notes:
+**  1. The table manager writes the JSON file header and closing brace.
+**  2. A map can't be loaded without the mutex so an empty map is dumped
+**     unlocked when the mutex wasn't created.
+**
+*/
+bool MEM_MAP_DumpCmd(osal_id_t FileHandle)
+{
+
+   uint32  i;
+   uint32  Size;
+   char    DumpRecord[256];
+   char    MemSizes[MEM_MAP_JSON_ATTR_STR_LEN];
+   const MEM_MAP_Region_t *Region;
+
+   if (MemMap->MutexCreated)
+   {
+      OS_MutSemTake(MemMap->MutexId);
+   }
+
+   sprintf(DumpRecord,"   \"region\": [");
+   OS_write(FileHandle, DumpRecord, strlen(DumpRecord));
+
+   for (i=0; i < MemMap->Data.RegionCnt; i++)
+   {
+      Region = &MemMap->Data.Region[i];
+
+      MemSizes[0] = '\0';
+      if (Region->MemSizes & (1 << MEM_MGR_MemSize_8))    strcat(MemSizes, "8,");
+      if (Region->MemSizes & (1 << MEM_MGR_MemSize_16))   strcat(MemSizes, "16,");
+      if (Region->MemSizes & (1 << MEM_MGR_MemSize_32))   strcat(MemSizes, "32,");
+      if (Region->MemSizes & (1 << MEM_MGR_MemSize_VOID)) strcat(MemSizes, "VOID,");
+      Size = strlen(MemSizes);
+      if (Size > 0)
+      {
+         MemSizes[Size-1] = '\0';
+      }
+
+      sprintf(DumpRecord,"%s\n      {\"name\": \"%s\", \"start-addr\": \"0x%llX\", \"byte-cnt\": %u,"
+                         " \"mem-type\": \"%s\", \"mem-sizes\": \"%s\", \"access\": \"%s%s\"}",
+              (i == 0) ? "" : ",", Region->Name, (unsigned long long)Region->StartAddr, (unsigned int)Region->ByteCnt,
+              Region->Mmio ? "MMIO" : MemTypeStr[Region->MemType], MemSizes,
+              (Region->Access & MEM_MAP_ACCESS_READ)  ? "R" : "",
+              (Region->Access & MEM_MAP_ACCESS_WRITE) ? "W" : "");
+      OS_write(FileHandle, DumpRecord, strlen(DumpRecord));
+   }
+
+   sprintf(DumpRecord,"\n   ]\n");
+   OS_write(FileHandle, DumpRecord, strlen(DumpRecord));
+
+   if (MemMap->MutexCreated)
+   {
+      OS_MutSemGive(MemMap->MutexId);
+   }
+
+   return true;
+
+} /* End MEM_MAP_DumpCmd() */
+
+
+/******************************************************************************
+** Function: MEM_MAP_Enabled
+**
+*/
+bool MEM_MAP_Enabled(void)
+{
+
+   return (MemMap->Data.RegionCnt > 0);
+
+} /* End MEM_MAP_Enabled() */
+
+
+/******************************************************************************
+** Function: MEM_MAP_LoadCmd
+**
+*/
+bool MEM_MAP_LoadCmd(TBLMGR_Tbl_t *Tbl, APP_C_FW_TblLoadOptions_Enum_t LoadType, const char *Filename)
+{
+
+   bool RetStatus = false;
+
+   if (MemMap->MutexCreated)
+   {
+      CFE_PSP_MemSet(JsonRegion, 0, sizeof(JsonRegion));
+
+      if (CJSON_ProcessFile(Filename, MemMap->JsonBuf, MEM_MAP_JSON_FILE_MAX_CHAR, LoadJsonData))
+      {
+         MemMap->Loaded = true;
+         RetStatus = true;
+      }
+   }
+   else
+   {
+      CFE_EVS_SendEvent(MEM_MAP_LOAD_EID, CFE_EVS_EventType_ERROR,
+                        "Memory map load rejected, the memory map mutex was not created");
+   }
+
+   return RetStatus;
+
+} /* End MEM_MAP_LoadCmd() */
+
+
+/******************************************************************************
+** Function: MEM_MAP_VerifyAddr
+**
+*/
+bool MEM_MAP_VerifyAddr(cpuaddr CpuAddr, uint32 ByteCnt, MEM_MGR_MemType_Enum_t MemType,
+                        MEM_MGR_MemSize_Enum_t MemSize, uint8 Access, bool *Mmio)
+{
+
+   bool  RetStatus = false;
+   const MEM_MAP_Region_t *Region;
+
+   *Mmio = false;
+   
+   OS_MutSemTake(MemMap->MutexId);
+
+   Region = FindRegion(CpuAddr);
+   if (Region == NULL)
+   {
+      CFE_EVS_SendEvent(MEM_MAP_VERIFY_ADDR_EID, CFE_EVS_EventType_ERROR,
+                        "Address %p is not in a memory map region", (void *)CpuAddr);
+   }
+   else if (ByteCnt > (Region->EndAddr - CpuAddr))
+   {
+      CFE_EVS_SendEvent(MEM_MAP_VERIFY_ADDR_EID, CFE_EVS_EventType_ERROR,
+                        "Address %p with byte count %u extends beyond the end of memory map region %s",
+                        (void *)CpuAddr, (unsigned int)ByteCnt, Region->Name);
+   }
+   else if (MemType != Region->MemType)
+   {
+      CFE_EVS_SendEvent(MEM_MAP_VERIFY_ADDR_EID, CFE_EVS_EventType_ERROR,
+                        "Memory type %d does not match memory map region %s type %s",
+                        MemType, Region->Name, MemTypeStr[Region->MemType]);
+   }
+   else if ((Region->MemSizes & (1 << MemSize)) == 0)
+   {
+      CFE_EVS_SendEvent(MEM_MAP_VERIFY_ADDR_EID, CFE_EVS_EventType_ERROR,
+                        "Memory size %d is not allowed in memory map region %s",
+                        MemSize, Region->Name);
+   }
+   else if ((MemSize != MEM_MGR_MemSize_VOID) && ((CpuAddr % MemSize) != 0))
+   {
+      /* The 8, 16 and 32 MemSize values are the number of bytes */
+      CFE_EVS_SendEvent(MEM_MAP_VERIFY_ADDR_EID, CFE_EVS_EventType_ERROR,
+                        "Address %p is not aligned for %d byte accesses", (void *)CpuAddr, MemSize);
+   }
+   else if ((Region->Access & Access) != Access)
+   {
+      CFE_EVS_SendEvent(MEM_MAP_VERIFY_ADDR_EID, CFE_EVS_EventType_ERROR,
+                        "%s access is not allowed in memory map region %s",
+                        (Access & MEM_MAP_ACCESS_WRITE) ? "Write" : "Read", Region->Name);
+   }
+   else
+   {
+      *Mmio = Region->Mmio;
+      RetStatus = true;
+   }
+
+   OS_MutSemGive(MemMap->MutexId);
+
+   return RetStatus;
+
+} /* End MEM_MAP_VerifyAddr() */
+
+
+/******************************************************************************
+** Function: ConvertRegion
+**
+** Notes:
+**   1. Convert a JSON region into a map region. Error events are sent for
+**      invalid values.
+**
+*/
+static bool ConvertRegion(const JsonRegion_t *JsonRegion, MEM_MAP_Region_t *Region)
+{
+
+   bool   RetStatus = false;
+   char   MemSizes[MEM_MAP_JSON_ATTR_STR_LEN];
+   char  *EndPtr;
+   char  *Token;
+   char  *SavePtr;
+
+   CFE_PSP_MemSet(Region, 0, sizeof(MEM_MAP_Region_t));
+   strncpy(Region->Name, JsonRegion->Name, OS_MAX_API_NAME - 1);
+
+   Region->StartAddr = (cpuaddr)strtoull(JsonRegion->StartAddr, &EndPtr, 16);
+   Region->ByteCnt   = JsonRegion->ByteCnt;
+   Region->EndAddr   = Region->StartAddr + Region->ByteCnt;
+
+   if (strcmp(JsonRegion->MemType, "RAM") == 0)
+   {
+      Region->MemType = MEM_MGR_MemType_RAM;
+   }
+   else if (strcmp(JsonRegion->MemType, "NONVOL") == 0)
+   {
+      Region->MemType = MEM_MGR_MemType_NONVOL;
+   }
+   else if (strcmp(JsonRegion->MemType, "MMIO") == 0)
+   {
+      Region->MemType = MEM_MGR_MemType_RAM;
+      Region->Mmio    = true;
+   }
+
+   strncpy(MemSizes, JsonRegion->MemSizes, sizeof(MemSizes) - 1);
+   MemSizes[sizeof(MemSizes) - 1] = '\0';
+   for (Token = strtok_r(MemSizes, ", ", &SavePtr); Token != NULL; Token = strtok_r(NULL, ", ", &SavePtr))
+   {
+      if      (strcmp(Token, "8")    == 0) Region->MemSizes |= (1 << MEM_MGR_MemSize_8);
+      else if (strcmp(Token, "16")   == 0) Region->MemSizes |= (1 << MEM_MGR_MemSize_16);
+      else if (strcmp(Token, "32")   == 0) Region->MemSizes |= (1 << MEM_MGR_MemSize_32);
+      else if (strcmp(Token, "VOID") == 0) Region->MemSizes |= (1 << MEM_MGR_MemSize_VOID);
+      else
+      {
+         Region->MemSizes = 0;
+         break;
+      }
+   }
+
+   if (strcmp(JsonRegion->Access, "R") == 0)
+   {
+      Region->Access = MEM_MAP_ACCESS_READ;
+   }
+   else if (strcmp(JsonRegion->Access, "W") == 0)
+   {
+      Region->Access = MEM_MAP_ACCESS_WRITE;
+   }
+   else if (strcmp(JsonRegion->Access, "RW") == 0)
+   {
+      Region->Access = MEM_MAP_ACCESS_READ | MEM_MAP_ACCESS_WRITE;
+   }
+
+   if (JsonRegion->StartAddr[0] == '\0' || *EndPtr != '\0')
+   {
+      CFE_EVS_SendEvent(MEM_MAP_LOAD_EID, CFE_EVS_EventType_ERROR,
+                        "Memory map region %s has an invalid start address '%s'",
+                        JsonRegion->Name, JsonRegion->StartAddr);
+   }
+   else if (Region->ByteCnt == 0 || Region->EndAddr < Region->StartAddr)
+   {
+      CFE_EVS_SendEvent(MEM_MAP_LOAD_EID, CFE_EVS_EventType_ERROR,
+                        "Memory map region %s has an invalid byte count %u",
+                        JsonRegion->Name, (unsigned int)Region->ByteCnt);
+   }
+   else if (Region->MemType == 0)
+   {
+      CFE_EVS_SendEvent(MEM_MAP_LOAD_EID, CFE_EVS_EventType_ERROR,
+                        "Memory map region %s has an invalid memory type '%s', must be RAM, MMIO or NONVOL",
+                        JsonRegion->Name, JsonRegion->MemType);
+   }
+   else if (Region->MemSizes == 0)
+   {
+      CFE_EVS_SendEvent(MEM_MAP_LOAD_EID, CFE_EVS_EventType_ERROR,
+                        "Memory map region %s has invalid memory sizes '%s', must be a list of 8, 16, 32, VOID",
+                        JsonRegion->Name, JsonRegion->MemSizes);
+   }
+   else if (Region->Access == 0)
+   {
+      CFE_EVS_SendEvent(MEM_MAP_LOAD_EID, CFE_EVS_EventType_ERROR,
+                        "Memory map region %s has an invalid access '%s', must be R, W, or RW",
+                        JsonRegion->Name, JsonRegion->Access);
+   }
+   else
+   {
+      RetStatus = true;
+   }
+
+   return RetStatus;
+
+} /* End ConvertRegion() */
+
+
+/******************************************************************************
+** Function: FindRegion
+**
+** Notes:
+**   1. The caller must own the map mutex.
+**   2. Regions are sorted and don't overlap so a binary search finds the
+**      only region that can contain the address. Returns NULL if no region
+**      contains the address.
+**
+*/
+static const MEM_MAP_Region_t *FindRegion(cpuaddr CpuAddr)
+{
+
+   const MEM_MAP_Region_t *Region = NULL;
+   int32 Low  = 0;
+   int32 High = (int32)MemMap->Data.RegionCnt - 1;
+   int32 Mid;
+
+   while (Low <= High)
+   {
+      Mid = Low + (High - Low) / 2;
+      if (CpuAddr < MemMap->Data.Region[Mid].StartAddr)
+      {
+         High = Mid - 1;
+      }
+      else if (CpuAddr >= MemMap->Data.Region[Mid].EndAddr)
+      {
+         Low = Mid + 1;
+      }
+      else
+      {
+         Region = &MemMap->Data.Region[Mid];
+         break;
+      }
+   }
+
+   return Region;
+
+} /* End FindRegion() */
+
+
+/******************************************************************************
+** Function: LoadJsonData
+**
+** Notes:
+**   1. The JSON regions are converted into a working buffer that replaces
+**      the current map only if every region is valid.
+**
+*/
+static bool LoadJsonData(size_t JsonFileLen)
+{
+
+   bool    RetStatus = true;
+   uint32  i;
+   CJSON_Obj_t *RegionObj;
+
+   MemMap->JsonFileLen = JsonFileLen;
+
+   for (i=0; i < (MEM_MGR_MEM_MAP_MAX_REGIONS * JSON_REGION_OBJS); i++)
+   {
+      JsonTblObjs[i].Updated = false;
+   }
+   CFE_PSP_MemSet(&TblData, 0, sizeof(MEM_MAP_Data_t));
+
+   CJSON_LoadObjArray(JsonTblObjs, MEM_MGR_MEM_MAP_MAX_REGIONS * JSON_REGION_OBJS,
+                      MemMap->JsonBuf, MemMap->JsonFileLen);
+
+   for (i=0; (i < MEM_MGR_MEM_MAP_MAX_REGIONS) && RetStatus; i++)
+   {
+      RegionObj = &JsonTblObjs[i * JSON_REGION_OBJS];
+      if (RegionObj[0].Updated)
+      {
+         if (RegionObj[1].Updated && RegionObj[2].Updated && RegionObj[3].Updated &&
+             RegionObj[4].Updated && RegionObj[5].Updated)
+         {
+            RetStatus = ConvertRegion(&JsonRegion[i], &TblData.Region[TblData.RegionCnt++]);
+         }
+         else
+         {
+            CFE_EVS_SendEvent(MEM_MAP_LOAD_EID, CFE_EVS_EventType_ERROR,
+                              "Memory map region[%u] %s is missing one or more definitions",
+                              (unsigned int)i, JsonRegion[i].Name);
+            RetStatus = false;
+         }
+      }
+   }
+
+   if (RetStatus)
+   {
+      RetStatus = SortRegions(&TblData);
+   }
+
+   if (RetStatus)
+   {
+      OS_MutSemTake(MemMap->MutexId);
+      memcpy(&MemMap->Data, &TblData, sizeof(MEM_MAP_Data_t));
+      OS_MutSemGive(MemMap->MutexId);
+
+      CFE_EVS_SendEvent(MEM_MAP_LOAD_EID, CFE_EVS_EventType_INFORMATION,
+                        "Loaded memory map with %u regions%s", (unsigned int)MemMap->Data.RegionCnt,
+                        (MemMap->Data.RegionCnt == 0) ? ", addresses are verified by the PSP" : "");
+   }
+
+   return RetStatus;
+
+} /* End LoadJsonData() */
+
+
+/******************************************************************************
+** Function: SortRegions
+**
+** Notes:
+**   1. Insertion sort by start address. The table is small and typically
+**      defined in address order so a simple sort is sufficient.
+**   2. Overlapping regions are rejected because a binary search requires
+**      disjoint intervals.
+**
+*/
+static bool SortRegions(MEM_MAP_Data_t *Data)
+{
+
+   bool    RetStatus = true;
+   int32   i, j;
+   MEM_MAP_Region_t Region;
+
+   for (i=1; i < Data->RegionCnt; i++)
+   {
+      Region = Data->Region[i];
+      for (j=i-1; (j >= 0) && (Data->Region[j].StartAddr > Region.StartAddr); j--)
+      {
+         Data->Region[j+1] = Data->Region[j];
+      }
+      Data->Region[j+1] = Region;
+   }
+
+   for (i=1; (i < Data->RegionCnt) && RetStatus; i++)
+   {
+      if (Data->Region[i].StartAddr < Data->Region[i-1].EndAddr)
+      {
+         CFE_EVS_SendEvent(MEM_MAP_LOAD_EID, CFE_EVS_EventType_ERROR,
+                           "Memory map regions %s and %s overlap",
+                           Data->Region[i-1].Name, Data->Region[i].Name);
+         RetStatus = false;
+      }
+   }
+
+   return RetStatus;
+
+} /* End SortRegions() */
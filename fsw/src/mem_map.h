@@ -0,0 +1,190 @@
+/*
+**  Copyright 2022 bitValence, Inc.
+**  All Rights Reserved.
+**
+**  This program is free software; you can modify and/or redistribute it
+**  under the terms of the GNU Affero General Public License
+**  as published by the Free Software Foundation; version 3 with
+**  attribution addendums as found in the LICENSE.txt
+**
+**  This program is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU Affero General Public License for more details.
+**
+**  Purpose:
+**    Define the memory map table class
+**
+**  Notes:
+**    1. The memory map is a JSON table of named memory regions. Each region
+**       defines the memory type, the allowed memory access sizes and the
+**       read/write permissions for a contiguous address range.
+**    2. When the table contains at least one region, MEMORY uses the map
+**       instead of CFE_PSP_MemValidateRange() to verify command addresses.
+**       Addresses that are not in a region are rejected. An empty table
+**       disables the map.
+**    3. Regions are stored sorted by start address so an address is located
+**       with a binary search. An address range must be contained within a
+**       single region.
+**
+*/
+
+#ifndef _mem_map_
+#define _mem_map_
+
+/*
+** Includes
+*/
+
+#include "app_cfg.h"
+
+
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+
+/*
+** Event Message IDs
+*/
+
+#define MEM_MAP_CONSTRUCTOR_EID  (MEM_MAP_BASE_EID + 0)
+#define MEM_MAP_LOAD_EID         (MEM_MAP_BASE_EID + 1)
+#define MEM_MAP_VERIFY_ADDR_EID  (MEM_MAP_BASE_EID + 2)
+
+/*
+** Region access permission bit masks
+*/
+
+#define MEM_MAP_ACCESS_READ   0x01
+#define MEM_MAP_ACCESS_WRITE  0x02
+
+
+/**********************/
+/** Type Definitions **/
+/**********************/
+
+
+/******************************************************************************
+** Table Structure
+*/
+
+typedef struct
+{
+
+   char     Name[OS_MAX_API_NAME];
+   cpuaddr  StartAddr;
+   cpuaddr  EndAddr;    // One byte past the end of the region
+   uint32   ByteCnt;
+   uint8    MemType;    // MEM_MGR_MemType_Enum_t
+   bool     Mmio;       // RAM type region containing memory mapped I/O
+   uint8    MemSizes;   // Bit mask, bit n set if MEM_MGR_MemSize_Enum_t n is allowed
+   uint8    Access;     // MEM_MAP_ACCESS_x bit mask
+
+} MEM_MAP_Region_t;
+
+
+typedef struct
+{
+
+   uint16            RegionCnt;
+   MEM_MAP_Region_t  Region[MEM_MGR_MEM_MAP_MAX_REGIONS];  // Sorted by StartAddr
+
+} MEM_MAP_Data_t;
+
+
+/******************************************************************************
+** MEM_MAP_Class
+*/
+
+typedef struct
+{
+
+   /*
+   ** MEM_MAP State Data
+   */
+
+   osal_id_t  MutexId;   // Addresses are verified by the app and child tasks
+   bool       MutexCreated;
+   bool       Loaded;
+
+   MEM_MAP_Data_t Data;
+
+   size_t  JsonFileLen;
+   char    JsonBuf[MEM_MAP_JSON_FILE_MAX_CHAR];
+
+} MEM_MAP_Class_t;
+
+
+/************************/
+/** Exported Functions **/
+/************************/
+
+
+/******************************************************************************
+** Function: MEM_MAP_Constructor
+**
+** Initialize the MEM_MAP object to a known state
+**
+** Notes:
+**   1. This must be called prior to any other function.
+**   2. The map is empty until a table is loaded.
+**
+*/
+void MEM_MAP_Constructor(MEM_MAP_Class_t *MemMapPtr);
+
+
+/******************************************************************************
+** Function: MEM_MAP_DumpCmd
+**
+** Notes:
+**  1. Function signature must match TBLMGR_DumpTblFuncPtr_t.
+**  2. Can assume valid table file name because this is a callback from
+**     the app framework table manager that has verified the file.
+**
+*/
+bool MEM_MAP_DumpCmd(osal_id_t FileHandle);
+
+
+/******************************************************************************
+** Function: MEM_MAP_Enabled
+**
+** Notes:
+**   1. Returns true if the map contains at least one region.
+**
+*/
+bool MEM_MAP_Enabled(void);
+
+
+/******************************************************************************
+** Function: MEM_MAP_LoadCmd
+**
+** Notes:
+**  1. Function signature must match TBLMGR_LoadTblFuncPtr_t.
+**  2. Can assume valid table file name because this is a callback from
+**     the app framework table manager that has verified the file.
+**  3. The regions in the file replace all of the current regions for both
+**     replace and update load types. The current map is unchanged if any
+**     region is invalid.
+**
+*/
+bool MEM_MAP_LoadCmd(TBLMGR_Tbl_t *Tbl, APP_C_FW_TblLoadOptions_Enum_t LoadType, const char *Filename);
+
+
+/******************************************************************************
+** Function: MEM_MAP_VerifyAddr
+**
+** Notes:
+**   1. Verify an address range is contained in a single region and the region
+**      allows the memory type, memory size and access. Error events are sent
+**      for verification failures.
+**   2. MEM_MAP_Enabled() should be used to determine whether the map is used.
+**      All addresses fail verification when the map is empty.
+**   3. Mmio is set to true if the address is in a memory mapped I/O region.
+**
+*/
+bool MEM_MAP_VerifyAddr(cpuaddr CpuAddr, uint32 ByteCnt, MEM_MGR_MemType_Enum_t MemType,
+                        MEM_MGR_MemSize_Enum_t MemSize, uint8 Access, bool *Mmio);
+
+
+#endif /* _mem_map_ */
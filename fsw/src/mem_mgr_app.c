@@ -40,6 +40,10 @@
 /* Convenience macros */
 #define  INITBL_OBJ    (&(MemMgr.IniTbl))
 #define  CMDMGR_OBJ    (&(MemMgr.CmdMgr))
+#define  CHILDMGR_OBJ  (&(MemMgr.ChildMgr))
+#define  TBLMGR_OBJ    (&(MemMgr.TblMgr))
+#define  MEMFILE_OBJ   (&(MemMgr.MemFile))
+#define  MEMREGION_OBJ (&(MemMgr.MemRegion))
 
 
 /*******************************/
@@ -133,6 +137,8 @@ bool MEM_MGR_ResetAppCmd(void* ObjDataPtr, const CFE_MSG_Message_t *MsgPtr)
 {
 
    CMDMGR_ResetStatus(CMDMGR_OBJ);
+   CHILDMGR_ResetStatus(CHILDMGR_OBJ);
+   TBLMGR_ResetStatus(TBLMGR_OBJ);
    MEMORY_ResetStatus(); 
    MEM_FILE_ResetStatus(); 
    
@@ -144,12 +150,21 @@ bool MEM_MGR_ResetAppCmd(void* ObjDataPtr, const CFE_MSG_Message_t *MsgPtr)
 /******************************************************************************
 ** Function: InitApp
 **
+** Notes:
+**   1. File-based commands are executed by the MEM_FILE child task so the
+**      command pipe remains responsive during long duration transfers. The
+**      main task validates the command length and queues the command to the
+**      child task. The child task's command counters report the completion
+**      status.
+**
 */
 static int32 InitApp(void)
 {
 
    int32 Status = APP_C_FW_CFS_ERROR;
    
+   CHILDMGR_TaskInit_t ChildTaskInit;
+   
 
    /*
    ** Initialize objects 
@@ -168,8 +183,37 @@ static int32 InitApp(void)
       ** Constuct app's contained objects
       */
 
-      MEMORY_Constructor(&MemMgr.Memory);
-      MEM_FILE_Constructor(&MemMgr.MemFile, INITBL_OBJ);
+      MEM_CRC_Constructor(&MemMgr.MemCrc);
+      MEM_MAP_Constructor(&MemMgr.MemMap);
+      MEMORY_Constructor(&MemMgr.Memory, INITBL_OBJ);
+      MEM_FILE_Constructor(MEMFILE_OBJ, INITBL_OBJ);
+      MEM_REGION_Constructor(MEMREGION_OBJ, INITBL_OBJ);
+      
+      /* MEM_PIPE, MEM_DWELL and Child Manager constructors send error events */
+
+      Status = MEM_PIPE_Constructor(&MemMgr.MemPipe, INITBL_OBJ);
+      
+      if (Status == CFE_SUCCESS)
+      {
+         Status = MEM_DWELL_Constructor(&MemMgr.MemDwell, INITBL_OBJ);
+      }
+      
+      if (Status == CFE_SUCCESS)
+      {
+         ChildTaskInit.TaskName  = INITBL_GetStrConfig(INITBL_OBJ, CFG_MEM_FILE_CHILD_NAME);
+         ChildTaskInit.PerfId    = INITBL_GetIntConfig(INITBL_OBJ, CFG_MEM_FILE_CHILD_PERF_ID);
+         ChildTaskInit.StackSize = INITBL_GetIntConfig(INITBL_OBJ, CFG_MEM_FILE_CHILD_STACK_SIZE);
+         ChildTaskInit.Priority  = INITBL_GetIntConfig(INITBL_OBJ, CFG_MEM_FILE_CHILD_PRIORITY);
+         Status = CHILDMGR_Constructor(CHILDMGR_OBJ, 
+                                       ChildMgr_TaskMainCmdDispatch,
+                                       NULL, 
+                                       &ChildTaskInit); 
+      }
+
+   } /* End if INITBL constructed */
+  
+   if (Status == CFE_SUCCESS)
+   {
       
       /*
       ** Initialize app level interfaces
@@ -182,19 +226,61 @@ static int32 InitApp(void)
       CMDMGR_Constructor(CMDMGR_OBJ);
       CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_NOOP_CC,  NULL, MEM_MGR_NoOpCmd,     0);
       CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_RESET_CC, NULL, MEM_MGR_ResetAppCmd, 0);
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_LOAD_TBL_CC, TBLMGR_OBJ, TBLMGR_LoadTblCmd, sizeof(APP_C_FW_LoadTbl_CmdPayload_t));
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_DUMP_TBL_CC, TBLMGR_OBJ, TBLMGR_DumpTblCmd, sizeof(APP_C_FW_DumpTbl_CmdPayload_t));
 
       CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_PEEK_CC,              NULL, MEMORY_PeekCmd,           sizeof(MEM_MGR_Peek_CmdPayload_t));      
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_PEEK_LIST_CC,         NULL, MEMORY_PeekListCmd,       sizeof(MEM_MGR_PeekList_CmdPayload_t));
       CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_POKE_CC,              NULL, MEMORY_PokeCmd,           sizeof(MEM_MGR_Poke_CmdPayload_t));
       CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_LOAD_WITH_INT_DIS_CC, NULL, MEMORY_LoadWithIntDisCmd, sizeof(MEM_MGR_LoadWithIntDis_CmdPayload_t));
       CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_DUMP_TO_EVENT_CC,     NULL, MEMORY_DumpToEventCmd,    sizeof(MEM_MGR_DumpToEvent_CmdPayload_t));
-      CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_FILL_CC,              NULL, MEMORY_FillCmd,           sizeof(MEM_MGR_Fill_CmdPayload_t));
       CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_LOOKUP_SYMBOL_CC,     NULL, MEMORY_LookupSymbolCmd,   sizeof(MEM_MGR_LookupSymbol_CmdPayload_t));
       CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_ENA_EEPROM_WRITE_CC,  NULL, MEMORY_EnaEepromWriteCmd, sizeof(MEM_MGR_EnaEepromWrite_CmdPayload_t));
       CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_DIS_EEPROM_WRITE_CC,  NULL, MEMORY_DisEepromWriteCmd, sizeof(MEM_MGR_DisEepromWrite_CmdPayload_t));
-
-      CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_LOAD_FROM_FILE_CC,       NULL, MEM_FILE_LoadCmd,       sizeof(MEM_MGR_LoadFromFile_CmdPayload_t));
-      CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_DUMP_TO_FILE_CC,         NULL, MEM_FILE_DumpCmd,       sizeof(MEM_MGR_DumpToFile_CmdPayload_t));
-      CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_DUMP_SYM_TBL_TO_FILE_CC, NULL, MEM_FILE_DumpSymTblCmd, sizeof(MEM_MGR_DumpSymTblToFile_CmdPayload_t));
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_FLUSH_SYM_CACHE_CC,   NULL, MEMORY_FlushSymCacheCmd,  0);
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_ENA_DWELL_CC,         NULL, MEM_DWELL_EnaCmd,         0);
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_DIS_DWELL_CC,         NULL, MEM_DWELL_DisCmd,         0);
+
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_LOAD_FROM_FILE_CC,       CHILDMGR_OBJ, CHILDMGR_InvokeChildCmd, sizeof(MEM_MGR_LoadFromFile_CmdPayload_t));
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_DUMP_TO_FILE_CC,         CHILDMGR_OBJ, CHILDMGR_InvokeChildCmd, sizeof(MEM_MGR_DumpToFile_CmdPayload_t));
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_DUMP_SYM_TBL_TO_FILE_CC, CHILDMGR_OBJ, CHILDMGR_InvokeChildCmd, sizeof(MEM_MGR_DumpSymTblToFile_CmdPayload_t));
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_REGION_CRC_CC,           CHILDMGR_OBJ, CHILDMGR_InvokeChildCmd, sizeof(MEM_MGR_RegionCrc_CmdPayload_t));
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_DUMP_TO_TLM_CC,          CHILDMGR_OBJ, CHILDMGR_InvokeChildCmd, sizeof(MEM_MGR_DumpToTlm_CmdPayload_t));
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_SEARCH_CC,               CHILDMGR_OBJ, CHILDMGR_InvokeChildCmd, sizeof(MEM_MGR_Search_CmdPayload_t));
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_COMPARE_WITH_FILE_CC,    CHILDMGR_OBJ, CHILDMGR_InvokeChildCmd, sizeof(MEM_MGR_CompareWithFile_CmdPayload_t));
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_COPY_CC,                 CHILDMGR_OBJ, CHILDMGR_InvokeChildCmd, sizeof(MEM_MGR_Copy_CmdPayload_t));
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_LOAD_PATCH_CC,           CHILDMGR_OBJ, CHILDMGR_InvokeChildCmd, sizeof(MEM_MGR_LoadPatch_CmdPayload_t));
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_BUILD_HASH_TREE_CC,      CHILDMGR_OBJ, CHILDMGR_InvokeChildCmd, sizeof(MEM_MGR_BuildHashTree_CmdPayload_t));
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_SEND_HASH_TREE_LEVEL_CC, CHILDMGR_OBJ, CHILDMGR_InvokeChildCmd, sizeof(MEM_MGR_SendHashTreeLevel_CmdPayload_t));
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_DUMP_REGIONS_CC,         CHILDMGR_OBJ, CHILDMGR_InvokeChildCmd, sizeof(MEM_MGR_DumpRegions_CmdPayload_t));
+
+      /* Fills are performed by the app or the child task depending on their size */
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_FILL_CC,         CHILDMGR_OBJ, MEMORY_FillCmd,        sizeof(MEM_MGR_Fill_CmdPayload_t));
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, MEM_MGR_PATTERN_FILL_CC, CHILDMGR_OBJ, MEMORY_PatternFillCmd, sizeof(MEM_MGR_PatternFill_CmdPayload_t));
+
+      CHILDMGR_RegisterFunc(CHILDMGR_OBJ, MEM_MGR_LOAD_FROM_FILE_CC,       MEMFILE_OBJ, MEM_FILE_LoadCmd);
+      CHILDMGR_RegisterFunc(CHILDMGR_OBJ, MEM_MGR_DUMP_TO_FILE_CC,         MEMFILE_OBJ, MEM_FILE_DumpCmd);
+      CHILDMGR_RegisterFunc(CHILDMGR_OBJ, MEM_MGR_DUMP_SYM_TBL_TO_FILE_CC, MEMFILE_OBJ, MEM_FILE_DumpSymTblCmd);
+      CHILDMGR_RegisterFunc(CHILDMGR_OBJ, MEM_MGR_REGION_CRC_CC,           MEMREGION_OBJ, MEM_REGION_CrcCmd);
+      CHILDMGR_RegisterFunc(CHILDMGR_OBJ, MEM_MGR_DUMP_TO_TLM_CC,          MEMREGION_OBJ, MEM_REGION_DumpToTlmCmd);
+      CHILDMGR_RegisterFunc(CHILDMGR_OBJ, MEM_MGR_SEARCH_CC,               MEMREGION_OBJ, MEM_REGION_SearchCmd);
+      CHILDMGR_RegisterFunc(CHILDMGR_OBJ, MEM_MGR_COMPARE_WITH_FILE_CC,    MEMFILE_OBJ, MEM_FILE_CompareCmd);
+      CHILDMGR_RegisterFunc(CHILDMGR_OBJ, MEM_MGR_COPY_CC,                 MEMREGION_OBJ, MEM_REGION_CopyCmd);
+      CHILDMGR_RegisterFunc(CHILDMGR_OBJ, MEM_MGR_LOAD_PATCH_CC,           MEMFILE_OBJ, MEM_FILE_LoadPatchCmd);
+      CHILDMGR_RegisterFunc(CHILDMGR_OBJ, MEM_MGR_BUILD_HASH_TREE_CC,      MEMREGION_OBJ, MEM_REGION_BuildHashTreeCmd);
+      CHILDMGR_RegisterFunc(CHILDMGR_OBJ, MEM_MGR_SEND_HASH_TREE_LEVEL_CC, MEMREGION_OBJ, MEM_REGION_SendHashTreeLevelCmd);
+      CHILDMGR_RegisterFunc(CHILDMGR_OBJ, MEM_MGR_DUMP_REGIONS_CC,         MEMFILE_OBJ, MEM_FILE_DumpRegionsCmd);
+      CHILDMGR_RegisterFunc(CHILDMGR_OBJ, MEM_MGR_FILL_CC,                 MEMREGION_OBJ, MEM_REGION_FillCmd);
+      CHILDMGR_RegisterFunc(CHILDMGR_OBJ, MEM_MGR_PATTERN_FILL_CC,         MEMREGION_OBJ, MEM_REGION_PatternFillCmd);
+      
+      /* Addresses are verified by the PSP if the memory map table doesn't load */
+      TBLMGR_Constructor(TBLMGR_OBJ, INITBL_GetStrConfig(INITBL_OBJ, CFG_APP_CFE_NAME));
+      TBLMGR_RegisterTblWithDef(TBLMGR_OBJ, MEM_MAP_TBL_NAME, MEM_MAP_LoadCmd, MEM_MAP_DumpCmd,
+                                INITBL_GetStrConfig(INITBL_OBJ, CFG_MEM_MAP_TBL_FILENAME));
+      
+      /* Dwell entries are verified so the dwell table must be loaded after the memory map */
+      TBLMGR_RegisterTblWithDef(TBLMGR_OBJ, MEM_DWELL_TBL_NAME, MEM_DWELL_LoadCmd, MEM_DWELL_DumpCmd,
+                                INITBL_GetStrConfig(INITBL_OBJ, CFG_MEM_DWELL_TBL_FILENAME));
       
       /*
       ** Initialize app messages 
@@ -211,9 +297,7 @@ static int32 InitApp(void)
                         "MEM_MGR App Initialized. Version %d.%d.%d",
                         MEM_MGR_MAJOR_VER, MEM_MGR_MINOR_VER, MEM_MGR_PLATFORM_REV);
 
-      Status = CFE_SUCCESS; 
-
-   } /* End if INITBL constructed */
+   } /* End if CHILDMGR constructed */
    
    return(Status);
 
@@ -251,6 +335,7 @@ static int32 ProcessCommands(void)
          } 
          else if (CFE_SB_MsgId_Equal(MsgId, MemMgr.SendStatusMid))
          {   
+            MEMORY_ManageSymCache();
             SendStatusTlm();
          }
          else
@@ -288,12 +373,38 @@ static void SendStatusTlm(void)
    Payload->ValidCmdCnt   = MemMgr.CmdMgr.ValidCmdCnt;
    Payload->InvalidCmdCnt = MemMgr.CmdMgr.InvalidCmdCnt;
 
+   Payload->ChildValidCmdCnt   = MemMgr.ChildMgr.ValidCmdCnt;
+   Payload->ChildInvalidCmdCnt = MemMgr.ChildMgr.InvalidCmdCnt;
+
    Payload->EepromWriteEna  = MemMgr.Memory.EepromWriteEna;
    Payload->LastMemFunction = MemMgr.Memory.CmdStatus.Function;
    Payload->LastMemAddr     = MemMgr.Memory.CmdStatus.Addr;
    Payload->LastMemType     = MemMgr.Memory.CmdStatus.Type;
    Payload->LastMemSize     = MemMgr.Memory.CmdStatus.Size;
    Payload->LastMemByteCnt  = MemMgr.Memory.CmdStatus.ByteCnt;
+   Payload->SymCacheHitCnt  = MemMgr.Memory.SymCache.HitCnt;
+   Payload->SymCacheMissCnt = MemMgr.Memory.SymCache.MissCnt;
+   Payload->MemMapRegionCnt = MemMgr.MemMap.Data.RegionCnt;
+
+   Payload->ChildFillActive      = MemMgr.MemRegion.FillStatus.Active;
+   Payload->ChildFillByteCnt     = MemMgr.MemRegion.FillStatus.ByteCnt;
+   Payload->ChildFillBytesFilled = MemMgr.MemRegion.FillStatus.BytesFilled;
+
+   Payload->DwellEnabled  = MemMgr.MemDwell.Enabled;
+   Payload->DwellEntryCnt = MEM_DWELL_EntryCnt();
+   Payload->DwellTickCnt  = MemMgr.MemDwell.TickCnt;
+
+   Payload->LastDumpCompression = MemMgr.MemFile.DumpStatus.Compression;
+   Payload->LastDumpFileDataLen = MemMgr.MemFile.DumpStatus.FileDataLen;
+   Payload->LastDumpCompRatio   = MemMgr.MemFile.DumpStatus.CompRatio;
+   Payload->LastDumpType        = MemMgr.MemFile.DumpStatus.DumpType;
+   Payload->LastDumpChangedCnt  = MemMgr.MemFile.DumpStatus.ChangedCnt;
+   Payload->LastDumpSegmentCnt  = MemMgr.MemFile.DumpStatus.SegmentCnt;
+
+   Payload->ChildPaceDutyPct    = MemMgr.MemFile.Pace.AchievedDutyPct;
+   Payload->ChildPaceByteRate   = MemMgr.MemFile.Pace.AchievedByteRate;
+   Payload->ChildPaceBlockLimit = MemMgr.MemFile.Pace.BlockLimit;
+   Payload->ChildPaceDelayMs    = MemMgr.MemFile.Pace.DelayMs;
    
    strncpy(Payload->LastMemFilename,MemMgr.MemFile.Filename,OS_MAX_PATH_LEN);
    
@@ -31,7 +31,12 @@
 
 #include "app_cfg.h"
 #include "memory.h"
+#include "mem_crc.h"
+#include "mem_dwell.h"
 #include "mem_file.h"
+#include "mem_map.h"
+#include "mem_pipe.h"
+#include "mem_region.h"
 
 
 /***********************/
@@ -75,8 +80,10 @@ typedef struct
    ** App Framework
    */ 
     
-   INITBL_Class_t  IniTbl; 
-   CMDMGR_Class_t  CmdMgr;
+   INITBL_Class_t    IniTbl; 
+   CMDMGR_Class_t    CmdMgr;
+   CHILDMGR_Class_t  ChildMgr;
+   TBLMGR_Class_t    TblMgr;
    
    /*
    ** Command Packets
@@ -98,8 +105,13 @@ typedef struct
    CFE_SB_MsgId_t   CmdMid;
    CFE_SB_MsgId_t   SendStatusMid;
    
-   MEMORY_Class_t   Memory;
-   MEM_FILE_Class_t MemFile;
+   MEM_CRC_Class_t     MemCrc;
+   MEM_DWELL_Class_t   MemDwell;
+   MEMORY_Class_t      Memory;
+   MEM_FILE_Class_t    MemFile;
+   MEM_MAP_Class_t     MemMap;
+   MEM_PIPE_Class_t    MemPipe;
+   MEM_REGION_Class_t  MemRegion;
    
 } MEM_MGR_Class_t;
 
@@ -0,0 +1,223 @@
+/*
+**  Copyright 2022 bitValence, Inc.
+**  All Rights Reserved.
+**
+**  This program is free software; you can modify and/or redistribute it
+**  under the terms of the GNU Affero General Public License
+**  as published by the Free Software Foundation; version 3 with
+**  attribution addendums as found in the LICENSE.txt
+**
+**  This program is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU Affero General Public License for more details.
+**
+**  Purpose:
+**    Implement the child task pacing controller
+**
+**  Notes:
+**    1. The block limit drops to its new target as soon as a burst overruns
+**       the window's busy budget and moves half way up to a higher target so
+**       a single fast burst doesn't swing the pacing.
+**
+*/
+
+/*
+** Include Files:
+*/
+
+#include <string.h>
+#include "mem_pace.h"
+
+
+/*******************************/
+/** Local Function Prototypes **/
+/*******************************/
+
+static void EndBurst(MEM_PACE_Class_t *Pace, int64 BusyUs, uint32 BurstBlocks);
+
+
+/******************************************************************************
+** Function: MEM_PACE_Constructor
+**
+** Notes:
+**   1. When the controller is enabled the first burst is a single block so
+**      the block limit is seeded from a measurement rather than from the ini
+**      file's block limit, which could overrun the window's busy budget.
+**
+*/
+void MEM_PACE_Constructor(MEM_PACE_Class_t *Pace, uint16 DutyPct, uint32 WindowMs,
+                          uint16 BlockLimit, uint32 DelayMs, uint32 PerfId)
+{
+
+   memset(Pace, 0, sizeof(MEM_PACE_Class_t));
+
+   Pace->DutyPct    = DutyPct;
+   Pace->WindowMs   = WindowMs;
+   Pace->PerfId     = PerfId;
+   Pace->BlockLimit = ((DutyPct < 100) || (BlockLimit == 0)) ? 1 : BlockLimit;
+   Pace->DelayMs    = DelayMs;
+
+   OS_GetLocalTime(&Pace->BurstStart);
+
+} /* End MEM_PACE_Constructor() */
+
+
+/******************************************************************************
+** Function: MEM_PACE_BlockSize
+**
+** Notes:
+**   1. The window's busy budget in nanoseconds is WindowMs*1000000*DutyPct/100.
+**
+*/
+uint32 MEM_PACE_BlockSize(const MEM_PACE_Class_t *Pace, uint32 MaxBlockSize)
+{
+
+   uint32  BlockSize = MaxBlockSize;
+   uint64  BudgetBytes;
+
+   if ((Pace->DutyPct < 100) && (Pace->NsPerByte != 0))
+   {
+      BudgetBytes = ((uint64)Pace->WindowMs * Pace->DutyPct * 10000) / Pace->NsPerByte;
+      if (BudgetBytes < MaxBlockSize)
+      {
+         BlockSize = (uint32)BudgetBytes & ~((uint32)3);
+         if (BlockSize < MEM_PACE_MIN_BLOCK_SIZE)
+         {
+            BlockSize = MEM_PACE_MIN_BLOCK_SIZE;
+         }
+         if (BlockSize > MaxBlockSize)
+         {
+            BlockSize = MaxBlockSize;
+         }
+      }
+   }
+
+   return BlockSize;
+
+} /* End MEM_PACE_BlockSize() */
+
+
+/******************************************************************************
+** Function: MEM_PACE_Pause
+**
+** Notes:
+**   1. The burst is measured before CHILDMGR_PauseTask() so the delay that
+**      ends the burst is computed from the burst's busy time.
+**   2. The delay is rounded up to a whole millisecond so the achieved duty
+**      cycle doesn't exceed DutyPct when the burst is short.
+**
+*/
+void MEM_PACE_Pause(MEM_PACE_Class_t *Pace, uint32 ByteCnt)
+{
+
+   bool       BurstComplete = ((Pace->BlockCount + 1) >= Pace->BlockLimit);
+   uint32     BurstBlocks   = Pace->BlockCount + 1;
+   int64      BusyUs = 0;
+   OS_time_t  BurstEnd;
+
+   Pace->BurstBytes += ByteCnt;
+
+   if (BurstComplete)
+   {
+      OS_GetLocalTime(&BurstEnd);
+      BusyUs = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(BurstEnd, Pace->BurstStart));
+      if (BusyUs < 1)
+      {
+         BusyUs = 1;
+      }
+      if (Pace->DutyPct < 100)
+      {
+         Pace->DelayMs = (uint32)(((BusyUs * (100 - Pace->DutyPct)) / Pace->DutyPct + 999) / 1000);
+      }
+   }
+
+   CHILDMGR_PauseTask(&Pace->BlockCount, Pace->BlockLimit, Pace->DelayMs, Pace->PerfId);
+
+   if (BurstComplete)
+   {
+      EndBurst(Pace, BusyUs, BurstBlocks);
+   }
+
+} /* End MEM_PACE_Pause() */
+
+
+/******************************************************************************
+** Function: MEM_PACE_Start
+**
+*/
+void MEM_PACE_Start(MEM_PACE_Class_t *Pace)
+{
+
+   Pace->BlockCount = 0;
+   Pace->BurstBytes = 0;
+   OS_GetLocalTime(&Pace->BurstStart);
+
+} /* End MEM_PACE_Start() */
+
+
+/******************************************************************************
+** Function: EndBurst
+**
+** Notes:
+**   1. Measure the achieved pacing over the burst and the delay that
+**      followed it, adjust the block limit and start the next burst.
+**   2. The block limit target is the number of blocks that take the
+**      window's busy budget of WindowMs*1000*DutyPct/100 microseconds.
+**   3. The first measured burst and any burst that overran the busy budget
+**      set the block limit to the target so the next burst stays within the
+**      budget. Only increases are smoothed.
+**
+*/
+static void EndBurst(MEM_PACE_Class_t *Pace, int64 BusyUs, uint32 BurstBlocks)
+{
+
+   int64      PeriodUs;
+   int64      NsPerByte;
+   int64      TargetLimit;
+   uint32     BlockLimit = Pace->BlockLimit;
+   bool       FirstBurst = (Pace->NsPerByte == 0);
+   OS_time_t  DelayEnd;
+
+   OS_GetLocalTime(&DelayEnd);
+   PeriodUs = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(DelayEnd, Pace->BurstStart));
+   if (PeriodUs < BusyUs)
+   {
+      PeriodUs = BusyUs;
+   }
+   Pace->BurstStart = DelayEnd;
+
+   Pace->AchievedDutyPct  = (uint16)((BusyUs * 100) / PeriodUs);
+   Pace->AchievedByteRate = (uint32)(((int64)Pace->BurstBytes * 1000000) / PeriodUs);
+
+   if (Pace->BurstBytes != 0)
+   {
+      NsPerByte = (BusyUs * 1000) / Pace->BurstBytes;
+      Pace->NsPerByte = (NsPerByte > 0xFFFFFFFF) ? 0xFFFFFFFF : ((NsPerByte < 1) ? 1 : (uint32)NsPerByte);
+   }
+   Pace->BurstBytes = 0;
+
+   if (Pace->DutyPct < 100)
+   {
+      TargetLimit = ((int64)Pace->WindowMs * Pace->DutyPct * 10 * BurstBlocks) / BusyUs;
+      if (TargetLimit < 1)
+      {
+         TargetLimit = 1;
+      }
+      else if (TargetLimit > MEM_PACE_MAX_BLOCK_LIMIT)
+      {
+         TargetLimit = MEM_PACE_MAX_BLOCK_LIMIT;
+      }
+
+      if (FirstBurst || (TargetLimit < BlockLimit))
+      {
+         BlockLimit = (uint32)TargetLimit;
+      }
+      else
+      {
+         BlockLimit = (BlockLimit + (uint32)TargetLimit + 1) / 2;
+      }
+      Pace->BlockLimit = (uint16)BlockLimit;
+   }
+
+} /* End EndBurst() */
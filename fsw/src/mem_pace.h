@@ -0,0 +1,151 @@
+/*
+**  Copyright 2022 bitValence, Inc.
+**  All Rights Reserved.
+**
+**  This program is free software; you can modify and/or redistribute it
+**  under the terms of the GNU Affero General Public License
+**  as published by the Free Software Foundation; version 3 with
+**  attribution addendums as found in the LICENSE.txt
+**
+**  This program is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU Affero General Public License for more details.
+**
+**  Purpose:
+**    Define the child task pacing controller
+**
+**  Notes:
+**    1. A child task loop calls MEM_PACE_Pause() after each block. A burst
+**       of BlockLimit blocks is followed by a DelayMs task delay so the
+**       task's share of the CPU is the burst time divided by the burst time
+**       plus the delay.
+**    2. When a duty cycle is configured the controller measures each
+**       burst's wall time and sets the delay that follows it so the burst is
+**       DutyPct of the burst plus the delay. The block limit is adjusted so
+**       a burst takes about DutyPct of WindowMs, which limits the busy time
+**       in any WindowMs interval to about DutyPct.
+**    3. Wall time is measured so time the task is preempted or waiting for
+**       file I/O counts as busy time. This errs on the side of yielding the
+**       CPU.
+**    4. A DutyPct of 100 disables the controller and the configured block
+**       limit and delay are used. The achieved duty cycle and rate are
+**       measured in both cases.
+**
+*/
+
+#ifndef _mem_pace_
+#define _mem_pace_
+
+/*
+** Includes
+*/
+
+#include "app_cfg.h"
+
+
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+#define MEM_PACE_MAX_BLOCK_LIMIT  1024
+#define MEM_PACE_MIN_BLOCK_SIZE     64
+
+
+/**********************/
+/** Type Definitions **/
+/**********************/
+
+
+/******************************************************************************
+** MEM_PACE_Class
+**
+** - NsPerByte is the cost of the last measured burst, zero until a burst has
+**   been measured.
+** - AchievedDutyPct and AchievedByteRate are measured over the last burst
+**   and the delay that followed it.
+*/
+
+typedef struct
+{
+
+   /*
+   ** Configuration
+   */
+
+   uint16  DutyPct;
+   uint32  WindowMs;
+   uint32  PerfId;
+
+   /*
+   ** Controller State
+   */
+
+   uint16     BlockCount;
+   uint16     BlockLimit;
+   uint32     DelayMs;
+   uint32     BurstBytes;
+   uint32     NsPerByte;
+   OS_time_t  BurstStart;
+
+   uint16  AchievedDutyPct;
+   uint32  AchievedByteRate;   // Bytes per second
+
+} MEM_PACE_Class_t;
+
+
+/************************/
+/** Exported Functions **/
+/************************/
+
+
+/******************************************************************************
+** Function: MEM_PACE_Constructor
+**
+** Initialize the MEM_PACE object to a known state
+**
+** Notes:
+**   1. BlockLimit and DelayMs are the fixed pacing used when DutyPct is 100.
+**      When the controller is enabled DelayMs is the initial delay and the
+**      block limit is seeded from the first burst.
+**
+*/
+void MEM_PACE_Constructor(MEM_PACE_Class_t *Pace, uint16 DutyPct, uint32 WindowMs,
+                          uint16 BlockLimit, uint32 DelayMs, uint32 PerfId);
+
+
+/******************************************************************************
+** Function: MEM_PACE_BlockSize
+**
+** Notes:
+**   1. Return the block size a transfer should use. MaxBlockSize is used
+**      unless the last measured burst shows a block of that size would take
+**      longer than the duty cycle's share of the window. The reduced size is
+**      a multiple of 4 and at least MEM_PACE_MIN_BLOCK_SIZE.
+**
+*/
+uint32 MEM_PACE_BlockSize(const MEM_PACE_Class_t *Pace, uint32 MaxBlockSize);
+
+
+/******************************************************************************
+** Function: MEM_PACE_Pause
+**
+** Notes:
+**   1. Call after each block of a transfer. ByteCnt is the number of bytes
+**      processed by the block and is only used to measure the rate.
+**
+*/
+void MEM_PACE_Pause(MEM_PACE_Class_t *Pace, uint32 ByteCnt);
+
+
+/******************************************************************************
+** Function: MEM_PACE_Start
+**
+** Notes:
+**   1. Call at the start of each transfer to start a new burst.
+**
+*/
+void MEM_PACE_Start(MEM_PACE_Class_t *Pace);
+
+
+#endif /* _mem_pace_ */
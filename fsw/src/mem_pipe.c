@@ -0,0 +1,473 @@
+/*
+**  Copyright 2022 bitValence, Inc.
+**  All Rights Reserved.
+**
+**  This program is free software; you can modify and/or redistribute it
+**  under the terms of the GNU Affero General Public License
+**  as published by the Free Software Foundation; version 3 with
+**  attribution addendums as found in the LICENSE.txt
+**
+**  This program is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU Affero General Public License for more details.
+**
+**  Purpose:
+**    Implement the MEM_PIPE_Class methods
+**
+**  Notes:
+**    1. The helper task is a CHILDMGR callback task. Each callback waits for
+**       the client to start a transfer, runs the transfer to completion and
+**       signals the client.
+**    2. The counting semaphores are created when a transfer is started and
+**       deleted when it is stopped. An aborted read transfer can leave the
+**       semaphore counts in an unknown state so recreating them is simpler
+**       and more robust than trying to rebalance them.
+**
+*/
+
+/*
+** Include Files:
+*/
+
+#include <string.h>
+#include "mem_pipe.h"
+
+
+/*******************************/
+/** Local Function Prototypes **/
+/*******************************/
+
+static bool CreateTransferSems(void);
+static void DeleteTransferSems(void);
+static void ReadFileBlocks(void);
+static bool TaskCallback(CHILDMGR_Class_t *ChildMgr);
+static void WriteFileBlocks(void);
+
+
+/**********************/
+/** Global File Data **/
+/**********************/
+
+static MEM_PIPE_Class_t *MemPipe = NULL;
+
+
+/******************************************************************************
+** Function: MEM_PIPE_Constructor
+**
+*/
+int32 MEM_PIPE_Constructor(MEM_PIPE_Class_t *MemPipePtr, const INITBL_Class_t *IniTbl)
+{
+
+   int32 Status;
+   CHILDMGR_TaskInit_t ChildTaskInit;
+
+   MemPipe = MemPipePtr;
+
+   CFE_PSP_MemSet((void*)MemPipe, 0, sizeof(MEM_PIPE_Class_t));
+
+   MemPipe->Mode = MEM_PIPE_MODE_IDLE;
+
+   Status = OS_BinSemCreate(&MemPipe->StartSem, "MEM_PIPE_START", 0, 0);
+   if (Status == OS_SUCCESS)
+   {
+      Status = OS_BinSemCreate(&MemPipe->DoneSem, "MEM_PIPE_DONE", 0, 0);
+   }
+
+   if (Status == OS_SUCCESS)
+   {
+
+      /* Child Manager constructor sends error events */
+
+      ChildTaskInit.TaskName  = INITBL_GetStrConfig(IniTbl, CFG_MEM_PIPE_CHILD_NAME);
+      ChildTaskInit.PerfId    = INITBL_GetIntConfig(IniTbl, CFG_MEM_PIPE_CHILD_PERF_ID);
+      ChildTaskInit.StackSize = INITBL_GetIntConfig(IniTbl, CFG_MEM_PIPE_CHILD_STACK_SIZE);
+      ChildTaskInit.Priority  = INITBL_GetIntConfig(IniTbl, CFG_MEM_PIPE_CHILD_PRIORITY);
+      Status = CHILDMGR_Constructor(&MemPipe->ChildMgr,
+                                    ChildMgr_TaskMainCallback,
+                                    TaskCallback,
+                                    &ChildTaskInit);
+
+      MemPipe->Initialized = (Status == CFE_SUCCESS);
+   }
+   else
+   {
+      CFE_EVS_SendEvent(MEM_PIPE_CONSTRUCTOR_EID, CFE_EVS_EventType_ERROR,
+                        "Error creating file pipeline semaphores, status = 0x%08X",
+                        (unsigned int)Status);
+   }
+
+   return Status;
+
+} /* End MEM_PIPE_Constructor() */
+
+
+/******************************************************************************
+** Function: MEM_PIPE_GetReadBuf
+**
+*/
+int32 MEM_PIPE_GetReadBuf(uint8 **Data)
+{
+
+   MEM_PIPE_Buf_t *Buf;
+
+   OS_CountSemTake(MemPipe->FullSem);
+
+   Buf   = &MemPipe->Buf[MemPipe->ConsumerIdx];
+   *Data = Buf->Data;
+
+   return Buf->Len;
+
+} /* End MEM_PIPE_GetReadBuf() */
+
+
+/******************************************************************************
+** Function: MEM_PIPE_GetWriteBuf
+**
+*/
+uint8 *MEM_PIPE_GetWriteBuf(void)
+{
+
+   OS_CountSemTake(MemPipe->EmptySem);
+
+   return MemPipe->Buf[MemPipe->ProducerIdx].Data;
+
+} /* End MEM_PIPE_GetWriteBuf() */
+
+
+/******************************************************************************
+** Function: MEM_PIPE_PutWriteBuf
+**
+*/
+bool MEM_PIPE_PutWriteBuf(uint32 Len)
+{
+
+   MemPipe->Buf[MemPipe->ProducerIdx].Len = Len;
+   MemPipe->ProducerIdx = (MemPipe->ProducerIdx + 1) % MEM_PIPE_BUF_CNT;
+
+   OS_CountSemGive(MemPipe->FullSem);
+
+   return MemPipe->IoStatus;
+
+} /* End MEM_PIPE_PutWriteBuf() */
+
+
+/******************************************************************************
+** Function: MEM_PIPE_ReleaseReadBuf
+**
+*/
+void MEM_PIPE_ReleaseReadBuf(void)
+{
+
+   MemPipe->ConsumerIdx = (MemPipe->ConsumerIdx + 1) % MEM_PIPE_BUF_CNT;
+
+   OS_CountSemGive(MemPipe->EmptySem);
+
+} /* End MEM_PIPE_ReleaseReadBuf() */
+
+
+/******************************************************************************
+** Function: MEM_PIPE_StartRead
+**
+*/
+bool MEM_PIPE_StartRead(osal_id_t FileHandle, uint32 BlockSize, uint32 ByteCnt)
+{
+
+   bool RetStatus = false;
+
+   if (MemPipe->Initialized && (MemPipe->Mode == MEM_PIPE_MODE_IDLE))
+   {
+      if (BlockSize > 0 && BlockSize <= MEM_FILE_IO_BLOCK_SIZE)
+      {
+         MemPipe->FileHandle = FileHandle;
+         MemPipe->BlockSize  = BlockSize;
+         MemPipe->ByteCnt    = ByteCnt;
+
+         if (CreateTransferSems())
+         {
+            MemPipe->Mode = MEM_PIPE_MODE_READ;
+            OS_BinSemGive(MemPipe->StartSem);
+            RetStatus = true;
+         }
+      }
+      else
+      {
+         CFE_EVS_SendEvent(MEM_PIPE_START_EID, CFE_EVS_EventType_ERROR,
+                           "Invalid file pipeline block size %u, must be between 1 and %u",
+                           (unsigned int)BlockSize, MEM_FILE_IO_BLOCK_SIZE);
+      }
+   }
+   else
+   {
+      CFE_EVS_SendEvent(MEM_PIPE_START_EID, CFE_EVS_EventType_ERROR,
+                        "File pipeline read rejected. Initialized=%d, Mode=%d",
+                        MemPipe->Initialized, MemPipe->Mode);
+   }
+
+   return RetStatus;
+
+} /* End MEM_PIPE_StartRead() */
+
+
+/******************************************************************************
+** Function: MEM_PIPE_StartWrite
+**
+*/
+bool MEM_PIPE_StartWrite(osal_id_t FileHandle)
+{
+
+   bool RetStatus = false;
+
+   if (MemPipe->Initialized && (MemPipe->Mode == MEM_PIPE_MODE_IDLE))
+   {
+      MemPipe->FileHandle = FileHandle;
+      MemPipe->BlockSize  = MEM_FILE_IO_BLOCK_SIZE;
+      MemPipe->ByteCnt    = 0;
+
+      if (CreateTransferSems())
+      {
+         MemPipe->Mode = MEM_PIPE_MODE_WRITE;
+         OS_BinSemGive(MemPipe->StartSem);
+         RetStatus = true;
+      }
+   }
+   else
+   {
+      CFE_EVS_SendEvent(MEM_PIPE_START_EID, CFE_EVS_EventType_ERROR,
+                        "File pipeline write rejected. Initialized=%d, Mode=%d",
+                        MemPipe->Initialized, MemPipe->Mode);
+   }
+
+   return RetStatus;
+
+} /* End MEM_PIPE_StartWrite() */
+
+
+/******************************************************************************
+** Function: MEM_PIPE_Stop
+**
+** Notes:
+**   1. A zero length write buffer tells the helper task all of the buffers
+**      have been flushed.
+**   2. The abort flag and the extra empty buffer token release the helper
+**      task if it is waiting for the client to consume a buffer. If the
+**      helper completed the read the token is discarded with the semaphore.
+**
+*/
+bool MEM_PIPE_Stop(void)
+{
+
+   bool RetStatus = false;
+
+   if (MemPipe->Mode != MEM_PIPE_MODE_IDLE)
+   {
+      if (MemPipe->Mode == MEM_PIPE_MODE_WRITE)
+      {
+         MEM_PIPE_GetWriteBuf();
+         MEM_PIPE_PutWriteBuf(0);
+      }
+      else
+      {
+         MemPipe->Abort = true;
+         OS_CountSemGive(MemPipe->EmptySem);
+      }
+
+      OS_BinSemTake(MemPipe->DoneSem);
+
+      DeleteTransferSems();
+      MemPipe->Mode = MEM_PIPE_MODE_IDLE;
+
+      RetStatus = MemPipe->IoStatus;
+   }
+
+   return RetStatus;
+
+} /* End MEM_PIPE_Stop() */
+
+
+/******************************************************************************
+** Function: CreateTransferSems
+**
+** Notes:
+**   1. All buffers start empty.
+**   2. A semaphore creation failure is treated as fatal for the pipeline
+**      because the OSAL object table is exhausted or corrupted.
+**
+*/
+static bool CreateTransferSems(void)
+{
+
+   int32 Status;
+
+   MemPipe->Abort       = false;
+   MemPipe->IoStatus    = true;
+   MemPipe->ProducerIdx = 0;
+   MemPipe->ConsumerIdx = 0;
+
+   Status = OS_CountSemCreate(&MemPipe->FullSem, "MEM_PIPE_FULL", 0, 0);
+   if (Status == OS_SUCCESS)
+   {
+      Status = OS_CountSemCreate(&MemPipe->EmptySem, "MEM_PIPE_EMPTY", MEM_PIPE_BUF_CNT, 0);
+   }
+
+   if (Status != OS_SUCCESS)
+   {
+      CFE_EVS_SendEvent(MEM_PIPE_START_EID, CFE_EVS_EventType_CRITICAL,
+                        "Error creating file pipeline buffer semaphores, status = 0x%08X. File transfers disabled",
+                        (unsigned int)Status);
+      MemPipe->Initialized = false;
+   }
+
+   return (Status == OS_SUCCESS);
+
+} /* End CreateTransferSems() */
+
+
+/******************************************************************************
+** Function: DeleteTransferSems
+**
+*/
+static void DeleteTransferSems(void)
+{
+
+   OS_CountSemDelete(MemPipe->FullSem);
+   OS_CountSemDelete(MemPipe->EmptySem);
+
+} /* End DeleteTransferSems() */
+
+
+/******************************************************************************
+** Function: ReadFileBlocks
+**
+** Notes:
+**   1. Runs in the helper task. The read ends after ByteCnt bytes, a short
+**      read, or when the client aborts the transfer.
+**
+*/
+static void ReadFileBlocks(void)
+{
+
+   uint32  BytesRemaining = MemPipe->ByteCnt;
+   uint32  ReadLen = MemPipe->BlockSize;
+   MEM_PIPE_Buf_t *Buf;
+
+   while (BytesRemaining > 0)
+   {
+
+      OS_CountSemTake(MemPipe->EmptySem);
+      if (MemPipe->Abort)
+      {
+         break;
+      }
+
+      if (BytesRemaining < ReadLen)
+      {
+         ReadLen = BytesRemaining;
+      }
+
+      Buf = &MemPipe->Buf[MemPipe->ProducerIdx];
+      Buf->Len = OS_read(MemPipe->FileHandle, Buf->Data, ReadLen);
+      if (Buf->Len == (int32)ReadLen)
+      {
+         BytesRemaining -= ReadLen;
+      }
+      else
+      {
+         MemPipe->IoStatus = false;
+         BytesRemaining = 0;
+         CFE_EVS_SendEvent(MEM_PIPE_READ_FILE_EID, CFE_EVS_EventType_ERROR,
+                           "File pipeline read error. Status=%d, Expected bytes=%u",
+                           (int)Buf->Len, (unsigned int)ReadLen);
+      }
+
+      MemPipe->ProducerIdx = (MemPipe->ProducerIdx + 1) % MEM_PIPE_BUF_CNT;
+      OS_CountSemGive(MemPipe->FullSem);
+
+   } /* End while bytes */
+
+} /* End ReadFileBlocks() */
+
+
+/******************************************************************************
+** Function: TaskCallback
+**
+** Notes:
+**   1. Returning false terminates the helper task so only do it if the
+**      start semaphore can't be used.
+**
+*/
+static bool TaskCallback(CHILDMGR_Class_t *ChildMgr)
+{
+
+   int32 Status;
+
+   Status = OS_BinSemTake(MemPipe->StartSem);
+   if (Status == OS_SUCCESS)
+   {
+      if (MemPipe->Mode == MEM_PIPE_MODE_READ)
+      {
+         ReadFileBlocks();
+      }
+      else if (MemPipe->Mode == MEM_PIPE_MODE_WRITE)
+      {
+         WriteFileBlocks();
+      }
+
+      OS_BinSemGive(MemPipe->DoneSem);
+   }
+   else
+   {
+      CFE_EVS_SendEvent(MEM_PIPE_CONSTRUCTOR_EID, CFE_EVS_EventType_CRITICAL,
+                        "File pipeline helper task terminating, start semaphore error 0x%08X",
+                        (unsigned int)Status);
+      MemPipe->Initialized = false;
+   }
+
+   return (Status == OS_SUCCESS);
+
+} /* End TaskCallback() */
+
+
+/******************************************************************************
+** Function: WriteFileBlocks
+**
+** Notes:
+**   1. Runs in the helper task. After a write error the remaining buffers are
+**      discarded so the client never blocks waiting for an empty buffer.
+**
+*/
+static void WriteFileBlocks(void)
+{
+
+   bool    Writing = true;
+   int32   WriteLen;
+   MEM_PIPE_Buf_t *Buf;
+
+   while (Writing)
+   {
+
+      OS_CountSemTake(MemPipe->FullSem);
+
+      Buf = &MemPipe->Buf[MemPipe->ConsumerIdx];
+      if (Buf->Len == 0)
+      {
+         Writing = false;
+      }
+      else if (MemPipe->IoStatus)
+      {
+         WriteLen = OS_write(MemPipe->FileHandle, Buf->Data, Buf->Len);
+         if (WriteLen != Buf->Len)
+         {
+            MemPipe->IoStatus = false;
+            CFE_EVS_SendEvent(MEM_PIPE_WRITE_FILE_EID, CFE_EVS_EventType_ERROR,
+                              "File pipeline write error. Status=%d, Expected bytes=%u",
+                              (int)WriteLen, (unsigned int)Buf->Len);
+         }
+      }
+
+      MemPipe->ConsumerIdx = (MemPipe->ConsumerIdx + 1) % MEM_PIPE_BUF_CNT;
+      OS_CountSemGive(MemPipe->EmptySem);
+
+   } /* End while writing */
+
+} /* End WriteFileBlocks() */
@@ -0,0 +1,219 @@
+/*
+**  Copyright 2022 bitValence, Inc.
+**  All Rights Reserved.
+**
+**  This program is free software; you can modify and/or redistribute it
+**  under the terms of the GNU Affero General Public License
+**  as published by the Free Software Foundation; version 3 with
+**  attribution addendums as found in the LICENSE.txt
+**
+**  This program is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU Affero General Public License for more details.
+**
+**  Purpose:
+**    Define the memory file I/O pipeline class
+**
+**  Notes:
+**    1. MEM_PIPE owns a helper child task that performs the file reads or
+**       writes for a MEM_FILE transfer. While the MEM_FILE child task copies
+**       one block to or from memory the helper task prefetches the next
+**       block from the file (load) or flushes the previous block to the
+**       file (dump).
+**    2. The pipeline has MEM_PIPE_BUF_CNT buffers of MEM_FILE_IO_BLOCK_SIZE
+**       bytes that are passed between the tasks using a pair of counting
+**       semaphores. One transfer can be active at a time and the MEM_FILE
+**       child task is the only client so no additional locking is required.
+**    3. A transfer is started with MEM_PIPE_StartRead() or
+**       MEM_PIPE_StartWrite() and must always be ended with MEM_PIPE_Stop(),
+**       including when the client aborts a transfer due to an error.
+**
+*/
+
+#ifndef _mem_pipe_
+#define _mem_pipe_
+
+/*
+** Includes
+*/
+
+#include "app_cfg.h"
+
+
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+
+/*
+** Event Message IDs
+*/
+
+#define MEM_PIPE_CONSTRUCTOR_EID  (MEM_PIPE_BASE_EID + 0)
+#define MEM_PIPE_START_EID        (MEM_PIPE_BASE_EID + 1)
+#define MEM_PIPE_READ_FILE_EID    (MEM_PIPE_BASE_EID + 2)
+#define MEM_PIPE_WRITE_FILE_EID   (MEM_PIPE_BASE_EID + 3)
+
+
+/**********************/
+/** Type Definitions **/
+/**********************/
+
+
+typedef enum
+{
+   MEM_PIPE_MODE_IDLE  = 0,
+   MEM_PIPE_MODE_READ  = 1,
+   MEM_PIPE_MODE_WRITE = 2
+
+} MEM_PIPE_Mode_t;
+
+
+typedef struct
+{
+   int32  Len;    // Read: bytes read or OS error, Write: bytes to write, 0 ends the transfer
+   uint8  Data[MEM_FILE_IO_BLOCK_SIZE];
+
+} MEM_PIPE_Buf_t;
+
+
+/******************************************************************************
+** MEM_PIPE_Class
+*/
+
+typedef struct
+{
+
+   /*
+   ** App Framework References
+   */
+
+   CHILDMGR_Class_t ChildMgr;
+
+   /*
+   ** MEM_PIPE State Data
+   */
+
+   bool             Initialized;
+   volatile bool    Abort;
+   volatile bool    IoStatus;  // Written by the helper task, read by the client
+   MEM_PIPE_Mode_t  Mode;
+
+   osal_id_t  StartSem;      // Binary: Client starts a helper transfer
+   osal_id_t  DoneSem;       // Binary: Helper completed a transfer
+   osal_id_t  FullSem;       // Counting: Buffers ready for the consumer
+   osal_id_t  EmptySem;      // Counting: Buffers available to the producer
+
+   osal_id_t  FileHandle;
+   uint32     BlockSize;
+   uint32     ByteCnt;
+
+   uint16     ProducerIdx;
+   uint16     ConsumerIdx;
+
+   MEM_PIPE_Buf_t Buf[MEM_PIPE_BUF_CNT];
+
+} MEM_PIPE_Class_t;
+
+
+/************************/
+/** Exported Functions **/
+/************************/
+
+
+/******************************************************************************
+** Function: MEM_PIPE_Constructor
+**
+** Initialize the MEM_PIPE object to a known state and create the helper
+** child task.
+**
+** Notes:
+**   1. This must be called prior to any other function.
+**   2. Returns CFE_SUCCESS if the helper task and semaphores were created.
+**
+*/
+int32 MEM_PIPE_Constructor(MEM_PIPE_Class_t *MemPipePtr, const INITBL_Class_t *IniTbl);
+
+
+/******************************************************************************
+** Function: MEM_PIPE_GetReadBuf
+**
+** Notes:
+**   1. Blocks until the helper task has read the next block from the file.
+**   2. Returns the number of bytes read or a negative OS error code. A return
+**      value less than the requested block size ends the transfer.
+**   3. MEM_PIPE_ReleaseReadBuf() must be called when the client is done with
+**      the buffer.
+**
+*/
+int32 MEM_PIPE_GetReadBuf(uint8 **Data);
+
+
+/******************************************************************************
+** Function: MEM_PIPE_GetWriteBuf
+**
+** Notes:
+**   1. Blocks until a buffer is available. The client fills the buffer and
+**      passes it to the helper task with MEM_PIPE_PutWriteBuf().
+**
+*/
+uint8 *MEM_PIPE_GetWriteBuf(void);
+
+
+/******************************************************************************
+** Function: MEM_PIPE_PutWriteBuf
+**
+** Notes:
+**   1. Queue the buffer returned by MEM_PIPE_GetWriteBuf() to be written.
+**   2. Returns false if a previous write failed. The write error is reported
+**      by the helper task and the client should abort the transfer.
+**
+*/
+bool MEM_PIPE_PutWriteBuf(uint32 Len);
+
+
+/******************************************************************************
+** Function: MEM_PIPE_ReleaseReadBuf
+**
+** Notes:
+**   1. Return the buffer from the last MEM_PIPE_GetReadBuf() to the helper.
+**
+*/
+void MEM_PIPE_ReleaseReadBuf(void);
+
+
+/******************************************************************************
+** Function: MEM_PIPE_StartRead
+**
+** Notes:
+**   1. Start prefetching ByteCnt bytes from the file's current position in
+**      BlockSize chunks. BlockSize must be <= MEM_FILE_IO_BLOCK_SIZE.
+**
+*/
+bool MEM_PIPE_StartRead(osal_id_t FileHandle, uint32 BlockSize, uint32 ByteCnt);
+
+
+/******************************************************************************
+** Function: MEM_PIPE_StartWrite
+**
+** Notes:
+**   1. Start writing buffers to the file's current position.
+**
+*/
+bool MEM_PIPE_StartWrite(osal_id_t FileHandle);
+
+
+/******************************************************************************
+** Function: MEM_PIPE_Stop
+**
+** Notes:
+**   1. A write transfer is flushed. A read transfer is aborted if the client
+**      stopped before all of the data was consumed.
+**   2. Returns true if all of the file I/O was successful.
+**
+*/
+bool MEM_PIPE_Stop(void);
+
+
+#endif /* _mem_pipe_ */
@@ -0,0 +1,1081 @@
+/*
+**  Copyright 2022 bitValence, Inc.
+**  All Rights Reserved.
+**
+**  This program is free software; you can modify and/or redistribute it
+**  under the terms of the GNU Affero General Public License
+**  as published by the Free Software Foundation; version 3 with
+**  attribution addendums as found in the LICENSE.txt
+**
+**  This program is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU Affero General Public License for more details.
+**
+**  Purpose:
+**    Implement the MEM_REGION_Class methods
+**
+**  Notes:
+**    1. Memory is read in BlockSize chunks using the commanded memory size
+**       so memory that must be accessed with a particular width is handled
+**       the same way as memory dumps.
+**
+*/
+
+/*
+** Include Files:
+*/
+
+#include <stddef.h>
+#include <string.h>
+#include "mem_region.h"
+#include "mem_crc.h"
+
+
+/*******************************/
+/** Local Function Prototypes **/
+/*******************************/
+
+static bool ComputeLeafHashes(MEM_HASH_TREE_Tree_t *Tree, MEM_MGR_MemSize_Enum_t MemSize, bool DirectAccess);
+static bool ComputeRegionCrc(MEM_MGR_CpuAddr_Atom_t CpuAddr, MEM_MGR_MemSize_Enum_t MemSize, bool DirectAccess, uint32 ByteCnt,
+                             MEM_MGR_CrcType_Enum_t CrcType, uint32 *Crc);
+static bool CopyRegion(const MEMORY_VerifiedMemory_t *SrcMemory, MEM_MGR_MemSize_Enum_t SrcMemSize,
+                       const MEMORY_VerifiedMemory_t *DestMemory, MEM_MGR_MemSize_Enum_t DestMemSize,
+                       uint32 ByteCnt, MEM_MGR_CrcType_Enum_t CrcType, uint32 *SrcCrc);
+static bool FillRegion(MEM_FILL_Pattern_t *Pattern, MEM_MGR_CpuAddr_Atom_t CpuAddr, uint32 ByteCnt, bool DirectAccess);
+static bool SearchRegion(const MEM_SEARCH_Pattern_t *Pattern, MEM_MGR_CpuAddr_Atom_t CpuAddr, MEM_MGR_MemSize_Enum_t MemSize,
+                         bool DirectAccess, uint32 ByteCnt, uint16 MaxMatches);
+static bool SendDumpTlm(MEM_MGR_CpuAddr_Atom_t CpuAddr, MEM_MGR_MemType_Enum_t MemType,
+                        MEM_MGR_MemSize_Enum_t MemSize, bool DirectAccess, uint32 ByteCnt, uint16 *PageCnt);
+static bool SendHashTreeTlm(uint8 Level, uint32 StartNode, uint16 NodeCnt);
+
+
+/**********************/
+/** Global File Data **/
+/**********************/
+
+static MEM_REGION_Class_t *MemRegion = NULL;
+
+
+/******************************************************************************
+** Function: MEM_REGION_Constructor
+**
+*/
+void MEM_REGION_Constructor(MEM_REGION_Class_t *MemRegionPtr, const INITBL_Class_t *IniTbl)
+{
+
+   MemRegion = MemRegionPtr;
+
+   CFE_PSP_MemSet((void*)MemRegion, 0, sizeof(MEM_REGION_Class_t));
+
+   MemRegion->TaskBlockLimit = INITBL_GetIntConfig(IniTbl, CFG_MEM_FILE_TASK_BLOCK_LIMIT);
+   MemRegion->TaskBlockDelay = INITBL_GetIntConfig(IniTbl, CFG_MEM_FILE_TASK_BLOCK_DELAY);
+   MemRegion->TaskPerfId     = INITBL_GetIntConfig(IniTbl, CFG_MEM_FILE_CHILD_PERF_ID);
+
+   /* Region blocks must hold a whole number of 32-bit memory locations */
+   MemRegion->BlockSize = INITBL_GetIntConfig(IniTbl, CFG_MEM_REGION_BLOCK_SIZE) & ~((uint32)3);
+   if (MemRegion->BlockSize == 0)
+   {
+      CFE_EVS_SendEvent(MEM_REGION_CONSTRUCTOR_EID, CFE_EVS_EventType_ERROR,
+                        "JSON init file error: MEM_REGION_BLOCK_SIZE must be at least 4 bytes, using %d",
+                        MEM_FILE_IO_BLOCK_SIZE);
+      MemRegion->BlockSize = MEM_FILE_IO_BLOCK_SIZE;
+   }
+   else if (MemRegion->BlockSize > MEM_FILE_IO_BLOCK_SIZE)
+   {
+      CFE_EVS_SendEvent(MEM_REGION_CONSTRUCTOR_EID, CFE_EVS_EventType_ERROR,
+                        "JSON init file error: MEM_REGION_BLOCK_SIZE %d has been limited to app_cfg.h's MEM_FILE_IO_BLOCK_SIZE %d. See app_cfg.h for details.",
+                        MemRegion->BlockSize, MEM_FILE_IO_BLOCK_SIZE);
+      MemRegion->BlockSize = MEM_FILE_IO_BLOCK_SIZE;
+   }
+
+   /* Fill blocks must hold a whole number of 32-bit memory locations */
+   MemRegion->FillBlockSize = INITBL_GetIntConfig(IniTbl, CFG_MEM_FILE_FILL_BLOCK_SIZE) & ~((uint32)3);
+   if (MemRegion->FillBlockSize == 0)
+   {
+      CFE_EVS_SendEvent(MEM_REGION_CONSTRUCTOR_EID, CFE_EVS_EventType_ERROR,
+                        "JSON init file error: MEM_FILE_FILL_BLOCK_SIZE must be at least 4 bytes, using %d",
+                        MEM_FILE_IO_BLOCK_SIZE);
+      MemRegion->FillBlockSize = MEM_FILE_IO_BLOCK_SIZE;
+   }
+   else if (MemRegion->FillBlockSize > MEM_FILE_IO_BLOCK_SIZE)
+   {
+      CFE_EVS_SendEvent(MEM_REGION_CONSTRUCTOR_EID, CFE_EVS_EventType_ERROR,
+                        "JSON init file error: MEM_FILE_FILL_BLOCK_SIZE %d has been limited to app_cfg.h's MEM_FILE_IO_BLOCK_SIZE %d. See app_cfg.h for details.",
+                        MemRegion->FillBlockSize, MEM_FILE_IO_BLOCK_SIZE);
+      MemRegion->FillBlockSize = MEM_FILE_IO_BLOCK_SIZE;
+   }
+
+   CFE_MSG_Init(CFE_MSG_PTR(MemRegion->RegionCrcTlm.TelemetryHeader),
+                CFE_SB_ValueToMsgId(INITBL_GetIntConfig(IniTbl, CFG_MEM_MGR_REGION_CRC_TLM_TOPICID)),
+                sizeof(MEM_MGR_RegionCrcTlm_t));
+
+   CFE_MSG_Init(CFE_MSG_PTR(MemRegion->DumpTlm.TelemetryHeader),
+                CFE_SB_ValueToMsgId(INITBL_GetIntConfig(IniTbl, CFG_MEM_MGR_DUMP_TLM_TOPICID)),
+                sizeof(MEM_MGR_DumpTlm_t));
+
+   CFE_MSG_Init(CFE_MSG_PTR(MemRegion->SearchTlm.TelemetryHeader),
+                CFE_SB_ValueToMsgId(INITBL_GetIntConfig(IniTbl, CFG_MEM_MGR_SEARCH_TLM_TOPICID)),
+                sizeof(MEM_MGR_SearchTlm_t));
+
+   CFE_MSG_Init(CFE_MSG_PTR(MemRegion->HashTreeTlm.TelemetryHeader),
+                CFE_SB_ValueToMsgId(INITBL_GetIntConfig(IniTbl, CFG_MEM_MGR_HASH_TREE_TLM_TOPICID)),
+                sizeof(MEM_MGR_HashTreeTlm_t));
+
+} /* End MEM_REGION_Constructor() */
+
+
+/******************************************************************************
+** Function: MEM_REGION_BuildHashTreeCmd
+**
+** Notes:
+**   1. MEM_HASH_TREE sends detailed tree parameter error events.
+**   2. The byte count and leaf size must be a whole number of memory size
+**      accesses so every leaf is read with the commanded width. They're
+**      checked after the memory size has been verified.
+**
+*/
+bool MEM_REGION_BuildHashTreeCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
+{
+
+   const MEM_MGR_BuildHashTree_CmdPayload_t *TreeCmd = CMDMGR_PAYLOAD_PTR(MsgPtr, MEM_MGR_BuildHashTree_t);
+   MEM_HASH_TREE_Tree_t *Tree = &MemRegion->HashTree;
+
+   bool    RetStatus = false;
+   uint32  ElementLen = (TreeCmd->MemSize == MEM_MGR_MemSize_VOID) ? 1 : TreeCmd->MemSize;
+   MEMORY_VerifiedMemory_t VerifiedMemory;
+
+   Tree->Valid = false;
+   
+   /* MEMORY_VerifyAddr() sends error events and rejects invalid memory sizes */
+   if (MEMORY_VerifyAddr(TreeCmd->SymbolAddr, TreeCmd->MemType, TreeCmd->MemSize,
+                         TreeCmd->ByteCnt, MEM_MAP_ACCESS_READ, &VerifiedMemory))
+   {
+      if (((TreeCmd->ByteCnt % ElementLen) != 0) || ((TreeCmd->LeafSize % ElementLen) != 0))
+      {
+         CFE_EVS_SendEvent(MEM_REGION_HASH_TREE_EID, CFE_EVS_EventType_ERROR,
+                           "Build hash tree rejected, byte count %u and leaf size %u must be multiples of the memory size",
+                           (unsigned int)TreeCmd->ByteCnt, (unsigned int)TreeCmd->LeafSize);
+      }
+      else if (MEM_HASH_TREE_Init(Tree, VerifiedMemory.CpuAddr, TreeCmd->ByteCnt, TreeCmd->LeafSize,
+                                  TreeCmd->Fanout, TreeCmd->CrcType))
+      {
+         if (ComputeLeafHashes(Tree, TreeCmd->MemSize, VerifiedMemory.DirectAccess))
+         {
+            MEM_HASH_TREE_ComputeLevels(Tree);
+            SendHashTreeTlm(0, 0, 1);
+
+            MemRegion->CmdStatus.Function  = MEM_MGR_MemFunction_HASH_TREE;
+            MemRegion->CmdStatus.Type      = TreeCmd->MemType;
+            MemRegion->CmdStatus.Size      = TreeCmd->MemSize;
+            MemRegion->CmdStatus.Addr      = VerifiedMemory.CpuAddr;
+            MemRegion->CmdStatus.Data      = Tree->Node[0];
+            MemRegion->CmdStatus.ByteCnt   = TreeCmd->ByteCnt;
+            MEMORY_SetCmdStatus(&MemRegion->CmdStatus);
+
+            CFE_EVS_SendEvent(MEM_REGION_HASH_TREE_EID, CFE_EVS_EventType_INFORMATION,
+                              "Built hash tree over %u bytes at %p with %u leaves and %u levels, root hash=0x%08X",
+                              (unsigned int)TreeCmd->ByteCnt, (void *)VerifiedMemory.CpuAddr,
+                              (unsigned int)MEM_HASH_TREE_LeafCnt(Tree), (unsigned int)Tree->LevelCnt,
+                              (unsigned int)Tree->Node[0]);
+
+            RetStatus = true;
+         }
+      }
+   }
+
+   return RetStatus;
+
+} /* End MEM_REGION_BuildHashTreeCmd() */
+
+
+/******************************************************************************
+** Function: MEM_REGION_CopyCmd
+**
+** Notes:
+**   1. The destination is verified for read access when the copy is
+**      verified with a CRC.
+**   2. The byte count is checked against the memory sizes after they have
+**      been verified.
+**
+*/
+bool MEM_REGION_CopyCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
+{
+
+   const MEM_MGR_Copy_CmdPayload_t *CopyCmd = CMDMGR_PAYLOAD_PTR(MsgPtr, MEM_MGR_Copy_t);
+
+   bool    RetStatus = false;
+   bool    CopyVerified = false;
+   uint8   DestAccess = MEM_MAP_ACCESS_WRITE;
+   uint32  SrcElementLen  = (CopyCmd->SrcMemSize  == MEM_MGR_MemSize_VOID) ? 1 : CopyCmd->SrcMemSize;
+   uint32  DestElementLen = (CopyCmd->DestMemSize == MEM_MGR_MemSize_VOID) ? 1 : CopyCmd->DestMemSize;
+   uint32  SrcCrc  = 0;
+   uint32  DestCrc = 0;
+   MEMORY_VerifiedMemory_t SrcMemory;
+   MEMORY_VerifiedMemory_t DestMemory;
+
+   if ((CopyCmd->CrcType != MEM_MGR_CrcType_UNDEF) && !MEM_CRC_ValidType(CopyCmd->CrcType))
+   {
+      CFE_EVS_SendEvent(MEM_REGION_COPY_EID, CFE_EVS_EventType_ERROR,
+                        "Copy rejected, invalid CRC type %d. See mem_mgr.xml CrcType for valid types.",
+                        CopyCmd->CrcType);
+   }
+   else
+   {
+      if (CopyCmd->CrcType != MEM_MGR_CrcType_UNDEF)
+      {
+         DestAccess |= MEM_MAP_ACCESS_READ;
+      }
+
+      /* MEMORY_VerifyAddr() sends error events and rejects invalid memory sizes */
+      if (MEMORY_VerifyAddr(CopyCmd->SrcSymbolAddr, CopyCmd->SrcMemType, CopyCmd->SrcMemSize,
+                            CopyCmd->ByteCnt, MEM_MAP_ACCESS_READ, &SrcMemory) &&
+          MEMORY_VerifyAddr(CopyCmd->DestSymbolAddr, CopyCmd->DestMemType, CopyCmd->DestMemSize,
+                            CopyCmd->ByteCnt, DestAccess, &DestMemory))
+      {
+         if (((CopyCmd->ByteCnt % SrcElementLen) != 0) || ((CopyCmd->ByteCnt % DestElementLen) != 0))
+         {
+            CFE_EVS_SendEvent(MEM_REGION_COPY_EID, CFE_EVS_EventType_ERROR,
+                              "Copy rejected, byte count %u must be a multiple of the source and destination memory sizes",
+                              (unsigned int)CopyCmd->ByteCnt);
+         }
+         else if ((SrcMemory.CpuAddr < (DestMemory.CpuAddr + CopyCmd->ByteCnt)) &&
+                  (DestMemory.CpuAddr < (SrcMemory.CpuAddr + CopyCmd->ByteCnt)))
+         {
+            CFE_EVS_SendEvent(MEM_REGION_COPY_EID, CFE_EVS_EventType_ERROR,
+                              "Copy rejected, %u byte source at %p overlaps destination at %p",
+                              (unsigned int)CopyCmd->ByteCnt, (void *)SrcMemory.CpuAddr, (void *)DestMemory.CpuAddr);
+         }
+         else if (CopyRegion(&SrcMemory, CopyCmd->SrcMemSize, &DestMemory, CopyCmd->DestMemSize,
+                             CopyCmd->ByteCnt, CopyCmd->CrcType, &SrcCrc))
+         {
+            if (CopyCmd->CrcType == MEM_MGR_CrcType_UNDEF)
+            {
+               RetStatus = true;
+            }
+            else if (ComputeRegionCrc(DestMemory.CpuAddr, CopyCmd->DestMemSize, DestMemory.DirectAccess,
+                                      CopyCmd->ByteCnt, CopyCmd->CrcType, &DestCrc))
+            {
+               if (DestCrc == SrcCrc)
+               {
+                  CopyVerified = true;
+                  RetStatus = true;
+               }
+               else
+               {
+                  CFE_EVS_SendEvent(MEM_REGION_COPY_EID, CFE_EVS_EventType_ERROR,
+                                    "Copy CRC error, destination at %p CRC=0x%08X, copied data CRC=0x%08X",
+                                    (void *)DestMemory.CpuAddr, (unsigned int)DestCrc, (unsigned int)SrcCrc);
+               }
+            }
+         }
+      }
+   }
+
+   if (RetStatus == true)
+   {
+      MemRegion->CmdStatus.Function  = MEM_MGR_MemFunction_COPY;
+      MemRegion->CmdStatus.Type      = CopyCmd->DestMemType;
+      MemRegion->CmdStatus.Size      = CopyCmd->DestMemSize;
+      MemRegion->CmdStatus.Addr      = DestMemory.CpuAddr;
+      MemRegion->CmdStatus.Data      = DestCrc;
+      MemRegion->CmdStatus.ByteCnt   = CopyCmd->ByteCnt;
+      MEMORY_SetCmdStatus(&MemRegion->CmdStatus);
+
+      if (CopyVerified)
+      {
+         CFE_EVS_SendEvent(MEM_REGION_COPY_EID, CFE_EVS_EventType_INFORMATION,
+                           "Copied %u bytes from %p to %p, verified destination CRC=0x%08X",
+                           (unsigned int)CopyCmd->ByteCnt, (void *)SrcMemory.CpuAddr, (void *)DestMemory.CpuAddr,
+                           (unsigned int)DestCrc);
+      }
+      else
+      {
+         CFE_EVS_SendEvent(MEM_REGION_COPY_EID, CFE_EVS_EventType_INFORMATION,
+                           "Copied %u bytes from %p to %p",
+                           (unsigned int)CopyCmd->ByteCnt, (void *)SrcMemory.CpuAddr, (void *)DestMemory.CpuAddr);
+      }
+   }
+
+   return RetStatus;
+
+} /* End MEM_REGION_CopyCmd() */
+
+/******************************************************************************
+** Function: MEM_REGION_CrcCmd
+**
+** Notes:
+**   1. Errors are reported by events. The telemetry packet is only sent when
+**      the CRC is successfully computed.
+**
+*/
+bool MEM_REGION_CrcCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
+{
+
+   const MEM_MGR_RegionCrc_CmdPayload_t *CrcCmd = CMDMGR_PAYLOAD_PTR(MsgPtr, MEM_MGR_RegionCrc_t);
+   MEM_MGR_RegionCrcTlm_Payload_t *Payload = &MemRegion->RegionCrcTlm.Payload;
+
+   bool    RetStatus = false;
+   uint32  Crc;
+   MEMORY_VerifiedMemory_t VerifiedMemory;
+
+   if (MEM_CRC_ValidType(CrcCmd->CrcType))
+   {
+      /* MEMORY_VerifyAddr() sends error events */
+      if (MEMORY_VerifyAddr(CrcCmd->SymbolAddr, CrcCmd->MemType, CrcCmd->MemSize,
+                            CrcCmd->ByteCnt, MEM_MAP_ACCESS_READ, &VerifiedMemory))
+      {
+         if (ComputeRegionCrc(VerifiedMemory.CpuAddr, CrcCmd->MemSize, VerifiedMemory.DirectAccess,
+                              CrcCmd->ByteCnt, CrcCmd->CrcType, &Crc))
+         {
+
+            CFE_SB_MessageStringGet(Payload->SymbolAddr.Name, CrcCmd->SymbolAddr.Name, NULL,
+                                    sizeof(MEM_MGR_SymbolName_String_t), sizeof(MEM_MGR_SymbolName_String_t));
+            Payload->SymbolAddr.Offset = CrcCmd->SymbolAddr.Offset;
+            Payload->CpuAddr = VerifiedMemory.CpuAddr;
+            Payload->MemType = CrcCmd->MemType;
+            Payload->MemSize = CrcCmd->MemSize;
+            Payload->ByteCnt = CrcCmd->ByteCnt;
+            Payload->CrcType = CrcCmd->CrcType;
+            Payload->Crc     = Crc;
+
+            CFE_SB_TimeStampMsg(CFE_MSG_PTR(MemRegion->RegionCrcTlm.TelemetryHeader));
+            CFE_SB_TransmitMsg(CFE_MSG_PTR(MemRegion->RegionCrcTlm.TelemetryHeader), true);
+
+            MemRegion->CmdStatus.Function  = MEM_MGR_MemFunction_REGION_CRC;
+            MemRegion->CmdStatus.Type      = CrcCmd->MemType;
+            MemRegion->CmdStatus.Size      = CrcCmd->MemSize;
+            MemRegion->CmdStatus.Addr      = VerifiedMemory.CpuAddr;
+            MemRegion->CmdStatus.Data      = Crc;
+            MemRegion->CmdStatus.ByteCnt   = CrcCmd->ByteCnt;
+            MEMORY_SetCmdStatus(&MemRegion->CmdStatus);
+
+            CFE_EVS_SendEvent(MEM_REGION_CRC_CMD_EID, CFE_EVS_EventType_INFORMATION,
+                              "Computed CRC type %d over %u bytes at address %p, CRC=0x%08X",
+                              CrcCmd->CrcType, (unsigned int)CrcCmd->ByteCnt, (void *)VerifiedMemory.CpuAddr,
+                              (unsigned int)Crc);
+
+            RetStatus = true;
+         }
+      }
+   }
+   else
+   {
+      CFE_EVS_SendEvent(MEM_REGION_CRC_CMD_EID, CFE_EVS_EventType_ERROR,
+                        "Region CRC command rejected, invalid CRC type %d. See mem_mgr.xml CrcType for valid types.",
+                        CrcCmd->CrcType);
+   }
+
+   return RetStatus;
+
+} /* End MEM_REGION_CrcCmd() */
+
+
+/******************************************************************************
+** Function: MEM_REGION_DumpToTlmCmd
+**
+** Notes:
+**   1. Errors are reported by events. If an error occurs after the first
+**      packet is sent the ground can detect the partial dump using PageNum
+**      and PageCnt.
+**
+*/
+bool MEM_REGION_DumpToTlmCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
+{
+
+   const MEM_MGR_DumpToTlm_CmdPayload_t *DumpCmd = CMDMGR_PAYLOAD_PTR(MsgPtr, MEM_MGR_DumpToTlm_t);
+
+   bool    RetStatus = false;
+   uint16  PageCnt;
+   MEMORY_VerifiedMemory_t VerifiedMemory;
+
+   if (DumpCmd->ByteCnt > 0 && DumpCmd->ByteCnt <= MEM_MGR_MAX_DUMP_TLM_DATA)
+   {
+      /* MEMORY_VerifyAddr() sends error events */
+      if (MEMORY_VerifyAddr(DumpCmd->SymbolAddr, DumpCmd->MemType, DumpCmd->MemSize,
+                            DumpCmd->ByteCnt, MEM_MAP_ACCESS_READ, &VerifiedMemory))
+      {
+         if (SendDumpTlm(VerifiedMemory.CpuAddr, DumpCmd->MemType, DumpCmd->MemSize, VerifiedMemory.DirectAccess,
+                         DumpCmd->ByteCnt, &PageCnt))
+         {
+
+            MemRegion->CmdStatus.Function  = MEM_MGR_MemFunction_DUMP_TO_TLM;
+            MemRegion->CmdStatus.Type      = DumpCmd->MemType;
+            MemRegion->CmdStatus.Size      = DumpCmd->MemSize;
+            MemRegion->CmdStatus.Addr      = VerifiedMemory.CpuAddr;
+            MemRegion->CmdStatus.Data      = PageCnt;
+            MemRegion->CmdStatus.ByteCnt   = DumpCmd->ByteCnt;
+            MEMORY_SetCmdStatus(&MemRegion->CmdStatus);
+
+            CFE_EVS_SendEvent(MEM_REGION_DUMP_TO_TLM_EID, CFE_EVS_EventType_INFORMATION,
+                              "Dumped %u bytes from address %p in %u telemetry packets",
+                              (unsigned int)DumpCmd->ByteCnt, (void *)VerifiedMemory.CpuAddr,
+                              (unsigned int)PageCnt);
+
+            RetStatus = true;
+         }
+      }
+   }
+   else
+   {
+      CFE_EVS_SendEvent(MEM_REGION_DUMP_TO_TLM_EID, CFE_EVS_EventType_ERROR,
+                        "Dump to telemetry rejected, byte count %u must be between 1 and %u",
+                        (unsigned int)DumpCmd->ByteCnt, (unsigned int)MEM_MGR_MAX_DUMP_TLM_DATA);
+   }
+
+   return RetStatus;
+
+} /* End MEM_REGION_DumpToTlmCmd() */
+
+
+/******************************************************************************
+** Function: MEM_REGION_FillCmd
+**
+** Notes:
+**   1. Uses the same MEM_FILL pattern as MEMORY_FillCmd() so background and
+**      foreground fills write the same memory values.
+**
+*/
+bool MEM_REGION_FillCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
+{
+
+   const MEM_MGR_Fill_CmdPayload_t *FillCmd = CMDMGR_PAYLOAD_PTR(MsgPtr, MEM_MGR_Fill_t);
+
+   bool    RetStatus = false;
+   MEMORY_VerifiedMemory_t VerifiedMemory;
+   MEM_FILL_Pattern_t      FillPattern;
+
+   /* MEMORY_VerifyAddr() sends error events */
+   if (MEMORY_VerifyAddr(FillCmd->SymbolAddr, FillCmd->MemType, FillCmd->MemSize,
+                         FillCmd->ByteCnt, MEM_MAP_ACCESS_WRITE, &VerifiedMemory))
+   {
+      MEM_FILL_InitValue(&FillPattern, FillCmd->MemSize, FillCmd->Data);
+      if (FillRegion(&FillPattern, VerifiedMemory.CpuAddr, FillCmd->ByteCnt, VerifiedMemory.DirectAccess))
+      {
+
+         MemRegion->CmdStatus.Function  = MEM_MGR_MemFunction_FILL;
+         MemRegion->CmdStatus.Type      = FillCmd->MemType;
+         MemRegion->CmdStatus.Size      = FillCmd->MemSize;
+         MemRegion->CmdStatus.Addr      = VerifiedMemory.CpuAddr;
+         MemRegion->CmdStatus.Data      = FillCmd->Data;
+         MemRegion->CmdStatus.ByteCnt   = FillCmd->ByteCnt;
+         MEMORY_SetCmdStatus(&MemRegion->CmdStatus);
+
+         CFE_EVS_SendEvent(MEM_REGION_FILL_EID, CFE_EVS_EventType_INFORMATION,
+                           "Successfully filled %u bytes of memory with %u starting at %p in the background",
+                           (unsigned int)FillCmd->ByteCnt, (unsigned int)FillCmd->Data,
+                           (void *)VerifiedMemory.CpuAddr);
+
+         RetStatus = true;
+      }
+   }
+
+   return RetStatus;
+
+} /* End MEM_REGION_FillCmd() */
+
+
+/******************************************************************************
+** Function: MEM_REGION_PatternFillCmd
+**
+** Notes:
+**   1. MEM_FILL sends detailed pattern error events.
+**
+*/
+bool MEM_REGION_PatternFillCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
+{
+
+   const MEM_MGR_PatternFill_CmdPayload_t *FillCmd = CMDMGR_PAYLOAD_PTR(MsgPtr, MEM_MGR_PatternFill_t);
+
+   bool    RetStatus = false;
+   MEMORY_VerifiedMemory_t VerifiedMemory;
+   MEM_FILL_Pattern_t      FillPattern;
+
+   if (MEM_FILL_InitPattern(&FillPattern, FillCmd->Pattern, FillCmd->MemSize,
+                            (const uint8 *)FillCmd->Data, FillCmd->PatternLen, FillCmd->Seed))
+   {
+      /* MEMORY_VerifyAddr() sends error events */
+      if (MEMORY_VerifyAddr(FillCmd->SymbolAddr, FillCmd->MemType, FillCmd->MemSize,
+                            FillCmd->ByteCnt, MEM_MAP_ACCESS_WRITE, &VerifiedMemory))
+      {
+         if (FillRegion(&FillPattern, VerifiedMemory.CpuAddr, FillCmd->ByteCnt, VerifiedMemory.DirectAccess))
+         {
+
+            MemRegion->CmdStatus.Function  = MEM_MGR_MemFunction_PATTERN_FILL;
+            MemRegion->CmdStatus.Type      = FillCmd->MemType;
+            MemRegion->CmdStatus.Size      = FillCmd->MemSize;
+            MemRegion->CmdStatus.Addr      = VerifiedMemory.CpuAddr;
+            MemRegion->CmdStatus.Data      = FillCmd->Seed;
+            MemRegion->CmdStatus.ByteCnt   = FillCmd->ByteCnt;
+            MEMORY_SetCmdStatus(&MemRegion->CmdStatus);
+
+            CFE_EVS_SendEvent(MEM_REGION_FILL_EID, CFE_EVS_EventType_INFORMATION,
+                              "Successfully filled %u bytes of memory with pattern %d starting at %p in the background",
+                              (unsigned int)FillCmd->ByteCnt, FillCmd->Pattern, (void *)VerifiedMemory.CpuAddr);
+
+            RetStatus = true;
+         }
+      }
+   }
+
+   return RetStatus;
+
+} /* End MEM_REGION_PatternFillCmd() */
+
+
+/******************************************************************************
+** Function: MEM_REGION_SearchCmd
+**
+** Notes:
+**   1. MEM_SEARCH sends detailed pattern error events.
+**   2. The byte count must be a whole number of memory size accesses so
+**      every block is read with the commanded width. It's checked after the
+**      memory size has been verified.
+**
+*/
+bool MEM_REGION_SearchCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
+{
+
+   const MEM_MGR_Search_CmdPayload_t *SearchCmd = CMDMGR_PAYLOAD_PTR(MsgPtr, MEM_MGR_Search_t);
+   MEM_MGR_SearchTlm_Payload_t *Payload = &MemRegion->SearchTlm.Payload;
+
+   bool    RetStatus = false;
+   uint32  ElementLen = (SearchCmd->MemSize == MEM_MGR_MemSize_VOID) ? 1 : SearchCmd->MemSize;
+   uint16  MaxMatches = sizeof(Payload->MatchAddr) / sizeof(Payload->MatchAddr[0]);
+   MEMORY_VerifiedMemory_t VerifiedMemory;
+   MEM_SEARCH_Pattern_t    SearchPattern;
+
+   if ((SearchCmd->MaxMatches == 0) || (SearchCmd->MaxMatches > MaxMatches))
+   {
+      CFE_EVS_SendEvent(MEM_REGION_SEARCH_EID, CFE_EVS_EventType_ERROR,
+                        "Search rejected, maximum matches %d must be between 1 and %d",
+                        SearchCmd->MaxMatches, MaxMatches);
+   }
+   else if (MEM_SEARCH_InitPattern(&SearchPattern, (const uint8 *)SearchCmd->Pattern, (const uint8 *)SearchCmd->Mask,
+                                   SearchCmd->PatternLen, SearchCmd->Stride))
+   {
+      /* MEMORY_VerifyAddr() sends error events and rejects invalid memory sizes */
+      if (MEMORY_VerifyAddr(SearchCmd->SymbolAddr, SearchCmd->MemType, SearchCmd->MemSize,
+                            SearchCmd->ByteCnt, MEM_MAP_ACCESS_READ, &VerifiedMemory))
+      {
+         if ((SearchCmd->ByteCnt < SearchCmd->PatternLen) || ((SearchCmd->ByteCnt % ElementLen) != 0))
+         {
+            CFE_EVS_SendEvent(MEM_REGION_SEARCH_EID, CFE_EVS_EventType_ERROR,
+                              "Search rejected, byte count %u must be at least the pattern length and a multiple of the memory size",
+                              (unsigned int)SearchCmd->ByteCnt);
+         }
+         else if (SearchRegion(&SearchPattern, VerifiedMemory.CpuAddr, SearchCmd->MemSize, VerifiedMemory.DirectAccess,
+                               SearchCmd->ByteCnt, SearchCmd->MaxMatches))
+         {
+
+            MemRegion->CmdStatus.Function  = MEM_MGR_MemFunction_SEARCH;
+            MemRegion->CmdStatus.Type      = SearchCmd->MemType;
+            MemRegion->CmdStatus.Size      = SearchCmd->MemSize;
+            MemRegion->CmdStatus.Addr      = VerifiedMemory.CpuAddr;
+            MemRegion->CmdStatus.Data      = Payload->MatchCnt;
+            MemRegion->CmdStatus.ByteCnt   = Payload->BytesSearched;
+            MEMORY_SetCmdStatus(&MemRegion->CmdStatus);
+
+            CFE_EVS_SendEvent(MEM_REGION_SEARCH_EID, CFE_EVS_EventType_INFORMATION,
+                              "Search found %u matches in %u of %u bytes starting at %p",
+                              (unsigned int)Payload->MatchCnt, (unsigned int)Payload->BytesSearched,
+                              (unsigned int)SearchCmd->ByteCnt, (void *)VerifiedMemory.CpuAddr);
+
+            RetStatus = true;
+         }
+      }
+   }
+
+   return RetStatus;
+
+} /* End MEM_REGION_SearchCmd() */
+
+
+/******************************************************************************
+** Function: MEM_REGION_SendHashTreeLevelCmd
+**
+*/
+bool MEM_REGION_SendHashTreeLevelCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
+{
+
+   const MEM_MGR_SendHashTreeLevel_CmdPayload_t *LevelCmd = CMDMGR_PAYLOAD_PTR(MsgPtr, MEM_MGR_SendHashTreeLevel_t);
+   MEM_MGR_HashTreeTlm_Payload_t *Payload = &MemRegion->HashTreeTlm.Payload;
+
+   bool    RetStatus = false;
+   uint16  MaxNodes = sizeof(Payload->Hash) / sizeof(Payload->Hash[0]);
+
+   if (!MemRegion->HashTree.Valid)
+   {
+      CFE_EVS_SendEvent(MEM_REGION_HASH_TREE_EID, CFE_EVS_EventType_ERROR,
+                        "Send hash tree level rejected, a hash tree has not been built");
+   }
+   else if ((LevelCmd->NodeCnt == 0) || (LevelCmd->NodeCnt > MaxNodes))
+   {
+      CFE_EVS_SendEvent(MEM_REGION_HASH_TREE_EID, CFE_EVS_EventType_ERROR,
+                        "Send hash tree level rejected, node count %d must be between 1 and %d",
+                        LevelCmd->NodeCnt, MaxNodes);
+   }
+   else if (SendHashTreeTlm(LevelCmd->Level, LevelCmd->StartNode, LevelCmd->NodeCnt))
+   {
+      CFE_EVS_SendEvent(MEM_REGION_HASH_TREE_EID, CFE_EVS_EventType_INFORMATION,
+                        "Sent %u hashes from hash tree level %u starting at node %u",
+                        (unsigned int)Payload->NodeCnt, (unsigned int)LevelCmd->Level,
+                        (unsigned int)LevelCmd->StartNode);
+
+      RetStatus = true;
+   }
+
+   return RetStatus;
+
+} /* End MEM_REGION_SendHashTreeLevelCmd() */
+
+
+/******************************************************************************
+** Function: ComputeLeafHashes
+**
+** Notes:
+**   1. Each leaf is hashed in chunks of up to BlockSize bytes and the task is
+**      paused between chunks. Chunks are a multiple of 4 bytes so every
+**      chunk is whole for every memory size.
+**   2. Direct access RAM is hashed in place, other memory is read into
+**      ReadBuf with the commanded memory size.
+**
+*/
+static bool ComputeLeafHashes(MEM_HASH_TREE_Tree_t *Tree, MEM_MGR_MemSize_Enum_t MemSize, bool DirectAccess)
+{
+
+   bool    RetStatus = true;
+   uint32  LeafCnt = MEM_HASH_TREE_LeafCnt(Tree);
+   uint32  Leaf;
+   uint32  Hash;
+   uint32  ChunkLen;
+   uint32  LeafBytesRemaining;
+   uint32  BytesRemaining = Tree->ByteCnt;
+   uint32  ChunkSize = MemRegion->BlockSize;
+   MEM_MGR_CpuAddr_Atom_t CpuAddr = Tree->StartAddr;
+   const uint8 *DataBuf = MemRegion->ReadBuf;
+
+   MemRegion->TaskBlockCount = 0;
+   for (Leaf=0; (Leaf < LeafCnt) && (RetStatus == true); Leaf++)
+   {
+
+      LeafBytesRemaining = (BytesRemaining < Tree->LeafSize) ? BytesRemaining : Tree->LeafSize;
+      BytesRemaining    -= LeafBytesRemaining;
+      Hash = 0;
+
+      while ((LeafBytesRemaining != 0) && (RetStatus == true))
+      {
+         ChunkLen = (LeafBytesRemaining < ChunkSize) ? LeafBytesRemaining : ChunkSize;
+
+         if (DirectAccess)
+         {
+            DataBuf = (const uint8 *)CpuAddr;
+         }
+         else
+         {
+            // Event sent by MEM_SIZEx_ReadBlock()
+            RetStatus = MEMORY_ReadBlock(MemRegion->ReadBuf, CpuAddr, MemSize, ChunkLen, false);
+         }
+
+         if (RetStatus == true)
+         {
+            Hash = MEM_CRC_Calculate(DataBuf, ChunkLen, Hash, Tree->CrcType);
+
+            CpuAddr            += ChunkLen;
+            LeafBytesRemaining -= ChunkLen;
+
+            if ((LeafBytesRemaining + BytesRemaining) != 0)
+            {
+               CHILDMGR_PauseTask(&MemRegion->TaskBlockCount, MemRegion->TaskBlockLimit, MemRegion->TaskBlockDelay, MemRegion->TaskPerfId);
+            }
+         }
+      } /* End while leaf bytes */
+
+      MEM_HASH_TREE_SetLeaf(Tree, Leaf, Hash);
+
+   } /* End leaf loop */
+
+   return RetStatus;
+
+} /* End ComputeLeafHashes() */
+
+
+/******************************************************************************
+** Function: ComputeRegionCrc
+**
+** Notes:
+**   1. TaskBlockCount is the count of "task blocks" performed. A task block is
+**      is group of instructions that is CPU intensive and may need to be
+**      periodically suspended to prevent CPU hogging.
+**
+*/
+static bool ComputeRegionCrc(MEM_MGR_CpuAddr_Atom_t CpuAddr, MEM_MGR_MemSize_Enum_t MemSize, bool DirectAccess, uint32 ByteCnt,
+                             MEM_MGR_CrcType_Enum_t CrcType, uint32 *Crc)
+{
+
+   bool    RetStatus = true;
+   uint32  BytesRemaining = ByteCnt;
+   uint32  ReadBlockSize = MemRegion->BlockSize;
+   uint32  CurrentCrc = 0;
+
+   MemRegion->TaskBlockCount = 0;
+   while ((BytesRemaining != 0) && (RetStatus == true))
+   {
+      if (BytesRemaining < ReadBlockSize)
+      {
+         ReadBlockSize = BytesRemaining;
+      }
+
+      // Event sent by MEM_SIZEx_ReadBlock()
+      RetStatus = MEMORY_ReadBlock(MemRegion->ReadBuf, CpuAddr, MemSize, ReadBlockSize, DirectAccess);
+      if (RetStatus == true)
+      {
+         CurrentCrc = MEM_CRC_Calculate(MemRegion->ReadBuf, ReadBlockSize, CurrentCrc, CrcType);
+
+         CpuAddr        += ReadBlockSize;
+         BytesRemaining -= ReadBlockSize;
+
+         if (BytesRemaining != 0)
+         {
+            CHILDMGR_PauseTask(&MemRegion->TaskBlockCount, MemRegion->TaskBlockLimit, MemRegion->TaskBlockDelay, MemRegion->TaskPerfId);
+         }
+      }
+   } /* End while bytes */
+
+   *Crc = CurrentCrc;
+
+   return RetStatus;
+
+} /* End ComputeRegionCrc() */
+
+
+/******************************************************************************
+** Function: CopyRegion
+**
+** Notes:
+**   1. Each chunk is read with the source memory size and written with the
+**      destination memory size by the MEM_SIZEx block functions. Chunks are
+**      a multiple of 4 bytes so every chunk is whole for every memory size.
+**   2. A direct access RAM source that is aligned for the destination memory
+**      size is written directly from the source.
+**   3. SrcCrc is the CRC of the data that was written. It isn't computed
+**      when CrcType is UNDEF.
+**
+*/
+static bool CopyRegion(const MEMORY_VerifiedMemory_t *SrcMemory, MEM_MGR_MemSize_Enum_t SrcMemSize,
+                       const MEMORY_VerifiedMemory_t *DestMemory, MEM_MGR_MemSize_Enum_t DestMemSize,
+                       uint32 ByteCnt, MEM_MGR_CrcType_Enum_t CrcType, uint32 *SrcCrc)
+{
+
+   bool    RetStatus = true;
+   uint32  DestElementLen = (DestMemSize == MEM_MGR_MemSize_VOID) ? 1 : DestMemSize;
+   bool    SrcInPlace = SrcMemory->DirectAccess && ((SrcMemory->CpuAddr % DestElementLen) == 0);
+   uint32  BytesRemaining = ByteCnt;
+   uint32  CopyBlockSize  = MemRegion->BlockSize;
+   uint32  CurrentCrc = 0;
+   MEM_MGR_CpuAddr_Atom_t SrcAddr  = SrcMemory->CpuAddr;
+   MEM_MGR_CpuAddr_Atom_t DestAddr = DestMemory->CpuAddr;
+   const uint8 *SrcBuf = MemRegion->ReadBuf;
+
+   MemRegion->TaskBlockCount = 0;
+   while ((BytesRemaining != 0) && (RetStatus == true))
+   {
+      if (BytesRemaining < CopyBlockSize)
+      {
+         CopyBlockSize = BytesRemaining;
+      }
+
+      if (SrcInPlace)
+      {
+         SrcBuf = (const uint8 *)SrcAddr;
+      }
+      else
+      {
+         // Event sent by MEM_SIZEx_ReadBlock()
+         RetStatus = MEMORY_ReadBlock(MemRegion->ReadBuf, SrcAddr, SrcMemSize, CopyBlockSize, SrcMemory->DirectAccess);
+      }
+
+      if (RetStatus == true)
+      {
+         // Event sent by MEM_SIZEx_WriteBlock()
+         RetStatus = MEMORY_WriteBlock(DestAddr, DestMemSize, SrcBuf, CopyBlockSize, DestMemory->DirectAccess);
+         if (RetStatus == true)
+         {
+            if (CrcType != MEM_MGR_CrcType_UNDEF)
+            {
+               CurrentCrc = MEM_CRC_Calculate(SrcBuf, CopyBlockSize, CurrentCrc, CrcType);
+            }
+
+            SrcAddr        += CopyBlockSize;
+            DestAddr       += CopyBlockSize;
+            BytesRemaining -= CopyBlockSize;
+
+            if (BytesRemaining != 0)
+            {
+               CHILDMGR_PauseTask(&MemRegion->TaskBlockCount, MemRegion->TaskBlockLimit, MemRegion->TaskBlockDelay, MemRegion->TaskPerfId);
+            }
+         }
+      }
+   } /* End while bytes */
+
+   *SrcCrc = CurrentCrc;
+
+   return RetStatus;
+
+} /* End CopyRegion() */
+
+/******************************************************************************
+** Function: FillRegion
+**
+** Notes:
+**   1. FillStatus is updated after each block so fill progress can be
+**      monitored in the app's status telemetry. BytesFilled is less than
+**      ByteCnt after a failed fill.
+**
+*/
+static bool FillRegion(MEM_FILL_Pattern_t *Pattern, MEM_MGR_CpuAddr_Atom_t CpuAddr, uint32 ByteCnt, bool DirectAccess)
+{
+
+   bool    RetStatus = true;
+   uint32  BytesRemaining = ByteCnt;
+   uint32  FillBlockSize  = MemRegion->FillBlockSize;
+
+   MemRegion->FillStatus.ByteCnt     = ByteCnt;
+   MemRegion->FillStatus.BytesFilled = 0;
+   MemRegion->FillStatus.Active      = true;
+
+   MemRegion->TaskBlockCount = 0;
+   while ((BytesRemaining != 0) && (RetStatus == true))
+   {
+      if (BytesRemaining < FillBlockSize)
+      {
+         FillBlockSize = BytesRemaining;
+      }
+
+      // Event sent by MEM_FILL_Write() or MEM_SIZEx_WriteBlock()
+      RetStatus = MEM_FILL_Write(Pattern, CpuAddr, FillBlockSize, DirectAccess);
+      if (RetStatus == true)
+      {
+         CpuAddr        += FillBlockSize;
+         BytesRemaining -= FillBlockSize;
+         MemRegion->FillStatus.BytesFilled += FillBlockSize;
+
+         if (BytesRemaining != 0)
+         {
+            CHILDMGR_PauseTask(&MemRegion->TaskBlockCount, MemRegion->TaskBlockLimit, MemRegion->TaskBlockDelay, MemRegion->TaskPerfId);
+         }
+      }
+   } /* End while bytes */
+
+   MemRegion->FillStatus.Active = false;
+
+   return RetStatus;
+
+} /* End FillRegion() */
+
+
+/******************************************************************************
+** Function: SearchRegion
+**
+** Notes:
+**   1. The region is scanned in windows of up to BlockSize bytes. NextPos
+**      is the region offset of the next untested candidate and each window
+**      starts at NextPos rounded down to the memory size so windows overlap
+**      by up to PatternLen-1 bytes.
+**   2. Direct access RAM is scanned in place. The window size still limits
+**      the work done between task pauses.
+**   3. The results packet is sent unless a memory read fails.
+**
+*/
+static bool SearchRegion(const MEM_SEARCH_Pattern_t *Pattern, MEM_MGR_CpuAddr_Atom_t CpuAddr, MEM_MGR_MemSize_Enum_t MemSize,
+                         bool DirectAccess, uint32 ByteCnt, uint16 MaxMatches)
+{
+
+   MEM_MGR_SearchTlm_Payload_t *Payload = &MemRegion->SearchTlm.Payload;
+
+   bool    RetStatus  = true;
+   uint32  ElementLen = (MemSize == MEM_MGR_MemSize_VOID) ? 1 : MemSize;
+   uint32  WindowSize = MemRegion->BlockSize;
+   uint32  NextPos    = 0;
+   uint32  WinStart;
+   uint32  WinLen;
+   uint32  Pos;
+   const uint8 *Window;
+
+   /* A window must hold at least one candidate */
+   if (WindowSize < (2 * MEM_SEARCH_PATTERN_MAX_LEN))
+   {
+      WindowSize = MEM_FILE_IO_BLOCK_SIZE;
+   }
+
+   Payload->StartAddr  = CpuAddr;
+   Payload->ByteCnt    = ByteCnt;
+   Payload->MatchCnt   = 0;
+   Payload->PatternLen = Pattern->Len;
+   Payload->Spare      = 0;
+
+   MemRegion->TaskBlockCount = 0;
+   while (RetStatus && ((NextPos + Pattern->Len) <= ByteCnt) && (Payload->MatchCnt < MaxMatches))
+   {
+
+      WinStart = NextPos - (NextPos % ElementLen);
+      WinLen   = ((ByteCnt - WinStart) < WindowSize) ? (ByteCnt - WinStart) : WindowSize;
+
+      if (DirectAccess)
+      {
+         Window = (const uint8 *)(CpuAddr + WinStart);
+      }
+      else
+      {
+         // Event sent by MEM_SIZEx_ReadBlock()
+         RetStatus = MEMORY_ReadBlock(MemRegion->ReadBuf, CpuAddr + WinStart, MemSize, WinLen, false);
+         Window = MemRegion->ReadBuf;
+      }
+
+      if (RetStatus == true)
+      {
+         Pos = NextPos - WinStart;
+         while ((Payload->MatchCnt < MaxMatches) &&
+                MEM_SEARCH_Scan(Pattern, Window, &Pos, WinLen - Pattern->Len + 1))
+         {
+            Payload->MatchAddr[Payload->MatchCnt++] = CpuAddr + WinStart + Pos;
+            Pos += Pattern->Stride;
+         }
+         NextPos = WinStart + Pos;
+
+         if (((NextPos + Pattern->Len) <= ByteCnt) && (Payload->MatchCnt < MaxMatches))
+         {
+            CHILDMGR_PauseTask(&MemRegion->TaskBlockCount, MemRegion->TaskBlockLimit, MemRegion->TaskBlockDelay, MemRegion->TaskPerfId);
+         }
+      }
+   } /* End while candidates */
+
+   if (RetStatus == true)
+   {
+      Payload->BytesSearched = (Payload->MatchCnt < MaxMatches) ? ByteCnt : NextPos;
+
+      CFE_MSG_SetSize(CFE_MSG_PTR(MemRegion->SearchTlm.TelemetryHeader),
+                      offsetof(MEM_MGR_SearchTlm_t, Payload.MatchAddr) + Payload->MatchCnt * sizeof(Payload->MatchAddr[0]));
+      CFE_SB_TimeStampMsg(CFE_MSG_PTR(MemRegion->SearchTlm.TelemetryHeader));
+      CFE_SB_TransmitMsg(CFE_MSG_PTR(MemRegion->SearchTlm.TelemetryHeader), true);
+   }
+
+   return RetStatus;
+
+} /* End SearchRegion() */
+
+
+/******************************************************************************
+** Function: SendDumpTlm
+**
+** Notes:
+**   1. Memory is read directly into the packet's data field so no
+**      intermediate buffer or formatting is needed.
+**   2. The task is paused between packets using the same limits as the other
+**      child task memory functions so large dumps don't flood the SB.
+**
+*/
+static bool SendDumpTlm(MEM_MGR_CpuAddr_Atom_t CpuAddr, MEM_MGR_MemType_Enum_t MemType,
+                        MEM_MGR_MemSize_Enum_t MemSize, bool DirectAccess, uint32 ByteCnt, uint16 *PageCnt)
+{
+
+   MEM_MGR_DumpTlm_Payload_t *Payload = &MemRegion->DumpTlm.Payload;
+
+   bool    RetStatus = true;
+   uint32  BytesRemaining = ByteCnt;
+   uint32  PageLen = sizeof(Payload->Data);
+
+   *PageCnt = (ByteCnt + PageLen - 1) / PageLen;
+
+   Payload->ByteCnt = ByteCnt;
+   Payload->PageNum = 0;
+   Payload->PageCnt = *PageCnt;
+   Payload->MemType = MemType;
+   Payload->MemSize = MemSize;
+
+   MemRegion->TaskBlockCount = 0;
+   while ((BytesRemaining != 0) && (RetStatus == true))
+   {
+      if (BytesRemaining < PageLen)
+      {
+         PageLen = BytesRemaining;
+      }
+
+      // Event sent by MEM_SIZEx_ReadBlock()
+      RetStatus = MEMORY_ReadBlock(Payload->Data, CpuAddr, MemSize, PageLen, DirectAccess);
+      if (RetStatus == true)
+      {
+         Payload->CpuAddr = CpuAddr;
+         Payload->DataLen = PageLen;
+         Payload->PageNum++;
+
+         CFE_MSG_SetSize(CFE_MSG_PTR(MemRegion->DumpTlm.TelemetryHeader),
+                         offsetof(MEM_MGR_DumpTlm_t, Payload.Data) + PageLen);
+         CFE_SB_TimeStampMsg(CFE_MSG_PTR(MemRegion->DumpTlm.TelemetryHeader));
+         CFE_SB_TransmitMsg(CFE_MSG_PTR(MemRegion->DumpTlm.TelemetryHeader), true);
+
+         CpuAddr        += PageLen;
+         BytesRemaining -= PageLen;
+
+         if (BytesRemaining != 0)
+         {
+            CHILDMGR_PauseTask(&MemRegion->TaskBlockCount, MemRegion->TaskBlockLimit, MemRegion->TaskBlockDelay, MemRegion->TaskPerfId);
+         }
+      }
+   } /* End while bytes */
+
+   return RetStatus;
+
+} /* End SendDumpTlm() */
+
+
+/******************************************************************************
+** Function: SendHashTreeTlm
+**
+** Notes:
+**   1. NodeCnt is limited to the nodes remaining in the level and the packet
+**      length only includes the hashes that are sent.
+**
+*/
+static bool SendHashTreeTlm(uint8 Level, uint32 StartNode, uint16 NodeCnt)
+{
+
+   MEM_HASH_TREE_Tree_t *Tree = &MemRegion->HashTree;
+   MEM_MGR_HashTreeTlm_Payload_t *Payload = &MemRegion->HashTreeTlm.Payload;
+
+   bool    RetStatus = false;
+   const uint32 *Hash;
+
+   Hash = MEM_HASH_TREE_GetNodes(Tree, Level, StartNode, &NodeCnt);
+   if (Hash != NULL)
+   {
+      Payload->StartAddr    = Tree->StartAddr;
+      Payload->ByteCnt      = Tree->ByteCnt;
+      Payload->LeafSize     = Tree->LeafSize;
+      Payload->Fanout       = Tree->Fanout;
+      Payload->LevelCnt     = Tree->LevelCnt;
+      Payload->CrcType      = Tree->CrcType;
+      Payload->Level        = Level;
+      Payload->Spare        = 0;
+      Payload->NodeCnt      = NodeCnt;
+      Payload->LevelNodeCnt = Tree->LevelNodeCnt[Level];
+      Payload->StartNode    = StartNode;
+      memcpy(Payload->Hash, Hash, NodeCnt * sizeof(Payload->Hash[0]));
+
+      CFE_MSG_SetSize(CFE_MSG_PTR(MemRegion->HashTreeTlm.TelemetryHeader),
+                      offsetof(MEM_MGR_HashTreeTlm_t, Payload.Hash) + NodeCnt * sizeof(Payload->Hash[0]));
+      CFE_SB_TimeStampMsg(CFE_MSG_PTR(MemRegion->HashTreeTlm.TelemetryHeader));
+      CFE_SB_TransmitMsg(CFE_MSG_PTR(MemRegion->HashTreeTlm.TelemetryHeader), true);
+
+      RetStatus = true;
+   }
+   else
+   {
+      CFE_EVS_SendEvent(MEM_REGION_HASH_TREE_EID, CFE_EVS_EventType_ERROR,
+                        "Hash tree level %u node %u doesn't exist, the tree has %u levels",
+                        (unsigned int)Level, (unsigned int)StartNode, (unsigned int)Tree->LevelCnt);
+   }
+
+   return RetStatus;
+
+} /* End SendHashTreeTlm() */
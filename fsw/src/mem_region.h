@@ -0,0 +1,247 @@
+/*
+**  Copyright 2022 bitValence, Inc.
+**  All Rights Reserved.
+**
+**  This program is free software; you can modify and/or redistribute it
+**  under the terms of the GNU Affero General Public License
+**  as published by the Free Software Foundation; version 3 with
+**  attribution addendums as found in the LICENSE.txt
+**
+**  This program is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU Affero General Public License for more details.
+**
+**  Purpose:
+**    Define the memory region class
+**
+**  Notes:
+**    1. MEM_REGION provides commands that operate on potentially large
+**       regions of memory without a file. The commands are registered with
+**       CHILDMGR and execute in the MEM_FILE child task so they can be
+**       paced using the MEM_FILE task block parameters.
+**    2. Fill commands are only executed by MEM_REGION when their byte count
+**       exceeds MEMORY's child task threshold. Fill progress is reported in
+**       the app's status telemetry.
+**    3. Searches scan direct access RAM in place and read other memory into
+**       ReadBuf. Windows overlap by the pattern length so matches that span
+**       blocks are found.
+**    4. Copies read the source into ReadBuf with the source memory size and
+**       write it with the destination memory size. Aligned direct access RAM
+**       sources are written without the intermediate copy.
+**    5. The last hash tree that was built is kept so the ground can request
+**       its levels with separate commands. The tree is a snapshot of memory
+**       when it was built.
+**
+*/
+
+#ifndef _mem_region_
+#define _mem_region_
+
+/*
+** Includes
+*/
+
+#include "app_cfg.h"
+#include "memory.h"
+#include "mem_fill.h"
+#include "mem_hash_tree.h"
+#include "mem_search.h"
+
+
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+
+/*
+** Event Message IDs
+*/
+
+#define MEM_REGION_CONSTRUCTOR_EID  (MEM_REGION_BASE_EID + 0)
+#define MEM_REGION_CRC_CMD_EID      (MEM_REGION_BASE_EID + 1)
+#define MEM_REGION_DUMP_TO_TLM_EID  (MEM_REGION_BASE_EID + 2)
+#define MEM_REGION_FILL_EID         (MEM_REGION_BASE_EID + 3)
+#define MEM_REGION_SEARCH_EID       (MEM_REGION_BASE_EID + 4)
+#define MEM_REGION_COPY_EID         (MEM_REGION_BASE_EID + 5)
+#define MEM_REGION_HASH_TREE_EID    (MEM_REGION_BASE_EID + 6)
+
+
+/**********************/
+/** Type Definitions **/
+/**********************/
+
+
+/******************************************************************************
+** Background fill progress
+*/
+
+typedef struct
+{
+
+   bool    Active;
+   uint32  ByteCnt;
+   uint32  BytesFilled;
+
+} MEM_REGION_FillStatus_t;
+
+
+/******************************************************************************
+** MEM_REGION_Class
+*/
+
+typedef struct
+{
+
+   /*
+   ** Telemetry Packets
+   */
+
+   MEM_MGR_RegionCrcTlm_t  RegionCrcTlm;
+   MEM_MGR_DumpTlm_t       DumpTlm;
+   MEM_MGR_SearchTlm_t     SearchTlm;
+   MEM_MGR_HashTreeTlm_t   HashTreeTlm;
+
+   /*
+   ** MEM_REGION State Data
+   */
+
+   MEMORY_CmdStatus_t CmdStatus;
+
+   uint16 TaskBlockCount;
+   uint32 TaskBlockLimit;
+   uint32 TaskBlockDelay;
+   uint32 TaskPerfId;
+
+   uint32 BlockSize;
+   uint8  ReadBuf[MEM_FILE_IO_BLOCK_SIZE];
+
+   uint32 FillBlockSize;
+   MEM_REGION_FillStatus_t FillStatus;
+
+   MEM_HASH_TREE_Tree_t HashTree;
+
+} MEM_REGION_Class_t;
+
+
+/************************/
+/** Exported Functions **/
+/************************/
+
+
+/******************************************************************************
+** Function: MEM_REGION_Constructor
+**
+** Initialize the MEM_REGION object to a known state
+**
+** Notes:
+**   1. This must be called prior to any other function.
+**
+*/
+void MEM_REGION_Constructor(MEM_REGION_Class_t *MemRegionPtr, const INITBL_Class_t *IniTbl);
+
+
+/******************************************************************************
+** Function: MEM_REGION_BuildHashTreeCmd
+**
+** Notes:
+**   1. Build a hash tree over a memory region and send the root level in the
+**      HashTreeTlm packet. The leaves are computed in BlockSize chunks and
+**      the task is paused between chunks.
+**   2. The previous tree is invalidated when the command is received so a
+**      failed build, including a parameter or address verification failure,
+**      leaves no valid tree.
+**
+*/
+bool MEM_REGION_BuildHashTreeCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr);
+
+
+/******************************************************************************
+** Function: MEM_REGION_CopyCmd
+**
+** Notes:
+**   1. Copy a memory region to a non-overlapping memory region. Both regions
+**      are verified before any memory is written.
+**   2. The copy is performed in BlockSize chunks and the task is paused
+**      between chunks. A failed copy may leave the destination partially
+**      written.
+**   3. If a CRC type is commanded the destination is read back after the
+**      copy and its CRC is compared with the CRC of the data that was
+**      written.
+**
+*/
+bool MEM_REGION_CopyCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr);
+
+
+/******************************************************************************
+** Function: MEM_REGION_CrcCmd
+**
+** Notes:
+**   1. Compute the CRC of a memory region and send the result in the
+**      RegionCrcTlm packet.
+**
+*/
+bool MEM_REGION_CrcCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr);
+
+
+/******************************************************************************
+** Function: MEM_REGION_DumpToTlmCmd
+**
+** Notes:
+**   1. Dump a memory region to a sequence of DumpTlm packets. Each packet's
+**      length only includes the valid data bytes.
+**   2. The maximum dump size is defined by MEM_MGR_MAX_DUMP_TLM_DATA in
+**      mem_mgr_platform_cfg.h.
+**
+*/
+bool MEM_REGION_DumpToTlmCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr);
+
+
+/******************************************************************************
+** Function: MEM_REGION_FillCmd
+**
+** Notes:
+**   1. Child task execution of a Fill command. The fill is performed in
+**      FillBlockSize byte blocks and the task is paused between blocks.
+**
+*/
+bool MEM_REGION_FillCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr);
+
+
+/******************************************************************************
+** Function: MEM_REGION_PatternFillCmd
+**
+** Notes:
+**   1. Child task execution of a PatternFill command, same as
+**      MEM_REGION_FillCmd().
+**
+*/
+bool MEM_REGION_PatternFillCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr);
+
+
+/******************************************************************************
+** Function: MEM_REGION_SearchCmd
+**
+** Notes:
+**   1. Search a memory region for a masked pattern and send the addresses of
+**      the first MaxMatches matches in the SearchTlm packet. The packet is
+**      sent when no matches are found.
+**
+*/
+bool MEM_REGION_SearchCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr);
+
+
+/******************************************************************************
+** Function: MEM_REGION_SendHashTreeLevelCmd
+**
+** Notes:
+**   1. Send up to NodeCnt consecutive node hashes from one level of the last
+**      hash tree that was built in the HashTreeTlm packet.
+**   2. Memory isn't read so the hashes describe memory when the tree was
+**      built.
+**
+*/
+bool MEM_REGION_SendHashTreeLevelCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr);
+
+
+#endif /* _mem_region_ */
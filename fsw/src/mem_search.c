@@ -0,0 +1,196 @@
+/*
+**  Copyright 2022 bitValence, Inc.
+**  All Rights Reserved.
+**
+**  This program is free software; you can modify and/or redistribute it
+**  under the terms of the GNU Affero General Public License
+**  as published by the Free Software Foundation; version 3 with
+**  attribution addendums as found in the LICENSE.txt
+**
+**  This program is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU Affero General Public License for more details.
+**
+**  Purpose:
+**    Implement the memory pattern search engine
+**
+**  Notes:
+**    1. Candidates are screened using the pattern's anchor byte, the first
+**       byte with a full mask. Byte aligned searches use memchr() to find
+**       the anchor so the C library's vectorized scan skips the memory that
+**       can't match. The remaining pattern bytes are only compared for
+**       locations that contain the anchor.
+**    2. Fully masked patterns are compared with memcmp(), partially masked
+**       patterns are compared a byte at a time.
+**
+*/
+
+/*
+** Include Files:
+*/
+
+#include <string.h>
+#include "mem_search.h"
+
+
+/*******************************/
+/** Local Function Prototypes **/
+/*******************************/
+
+static bool Match(const MEM_SEARCH_Pattern_t *Pattern, const uint8 *Buf);
+
+
+/******************************************************************************
+** Function: MEM_SEARCH_InitPattern
+**
+*/
+bool MEM_SEARCH_InitPattern(MEM_SEARCH_Pattern_t *Pattern, const uint8 *Data,
+                            const uint8 *Mask, uint16 Len, uint16 Stride)
+{
+
+   bool   RetStatus = false;
+   uint16 i;
+
+   memset(Pattern, 0, sizeof(MEM_SEARCH_Pattern_t));
+
+   if ((Len == 0) || (Len > MEM_SEARCH_PATTERN_MAX_LEN))
+   {
+      CFE_EVS_SendEvent(MEM_SEARCH_INIT_PATTERN_EID, CFE_EVS_EventType_ERROR,
+                        "Search pattern error: Pattern length %d must be 1 to %d bytes",
+                        Len, MEM_SEARCH_PATTERN_MAX_LEN);
+   }
+   else if (Stride == 0)
+   {
+      CFE_EVS_SendEvent(MEM_SEARCH_INIT_PATTERN_EID, CFE_EVS_EventType_ERROR,
+                        "Search pattern error: Stride must be non-zero");
+   }
+   else
+   {
+      Pattern->Len      = Len;
+      Pattern->Stride   = Stride;
+      Pattern->Anchor   = MEM_SEARCH_NO_ANCHOR;
+      Pattern->FullMask = true;
+
+      for (i=0; i < Len; i++)
+      {
+         Pattern->Mask[i] = Mask[i];
+         Pattern->Data[i] = Data[i] & Mask[i];
+         if (Mask[i] == 0xFF)
+         {
+            if (Pattern->Anchor == MEM_SEARCH_NO_ANCHOR)
+            {
+               Pattern->Anchor = i;
+            }
+         }
+         else
+         {
+            Pattern->FullMask = false;
+         }
+      }
+
+      RetStatus = true;
+   }
+
+   return RetStatus;
+
+} /* End MEM_SEARCH_InitPattern() */
+
+
+/******************************************************************************
+** Function: MEM_SEARCH_Scan
+**
+*/
+bool MEM_SEARCH_Scan(const MEM_SEARCH_Pattern_t *Pattern, const uint8 *Buf,
+                     uint32 *Pos, uint32 EndPos)
+{
+
+   bool    RetStatus = false;
+   uint32  Candidate = *Pos;
+   uint16  Anchor    = Pattern->Anchor;
+   const uint8 *AnchorPtr;
+
+   if (Anchor == MEM_SEARCH_NO_ANCHOR)
+   {
+      while (!RetStatus && (Candidate < EndPos))
+      {
+         if (Match(Pattern, &Buf[Candidate]))
+         {
+            RetStatus = true;
+         }
+         else
+         {
+            Candidate += Pattern->Stride;
+         }
+      }
+   }
+   else if (Pattern->Stride == 1)
+   {
+      while (!RetStatus && (Candidate < EndPos))
+      {
+         AnchorPtr = memchr(&Buf[Candidate + Anchor], Pattern->Data[Anchor], EndPos - Candidate);
+         if (AnchorPtr == NULL)
+         {
+            Candidate = EndPos;
+         }
+         else
+         {
+            Candidate = (uint32)(AnchorPtr - Buf) - Anchor;
+            if (Match(Pattern, &Buf[Candidate]))
+            {
+               RetStatus = true;
+            }
+            else
+            {
+               Candidate++;
+            }
+         }
+      }
+   }
+   else
+   {
+      while (!RetStatus && (Candidate < EndPos))
+      {
+         if ((Buf[Candidate + Anchor] == Pattern->Data[Anchor]) && Match(Pattern, &Buf[Candidate]))
+         {
+            RetStatus = true;
+         }
+         else
+         {
+            Candidate += Pattern->Stride;
+         }
+      }
+   }
+
+   *Pos = Candidate;
+
+   return RetStatus;
+
+} /* End MEM_SEARCH_Scan() */
+
+
+/******************************************************************************
+** Function: Match
+**
+*/
+static bool Match(const MEM_SEARCH_Pattern_t *Pattern, const uint8 *Buf)
+{
+
+   bool   RetStatus = true;
+   uint16 i;
+
+   if (Pattern->FullMask)
+   {
+      RetStatus = (memcmp(Buf, Pattern->Data, Pattern->Len) == 0);
+   }
+   else
+   {
+      for (i=0; (i < Pattern->Len) && RetStatus; i++)
+      {
+         RetStatus = ((Buf[i] & Pattern->Mask[i]) == Pattern->Data[i]);
+      }
+   }
+
+   return RetStatus;
+
+} /* End Match() */
@@ -0,0 +1,108 @@
+/*
+**  Copyright 2022 bitValence, Inc.
+**  All Rights Reserved.
+**
+**  This program is free software; you can modify and/or redistribute it
+**  under the terms of the GNU Affero General Public License
+**  as published by the Free Software Foundation; version 3 with
+**  attribution addendums as found in the LICENSE.txt
+**
+**  This program is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU Affero General Public License for more details.
+**
+**  Purpose:
+**    Define the memory pattern search engine
+**
+**  Notes:
+**    1. A pattern is up to MEM_SEARCH_PATTERN_MAX_LEN bytes with a bit mask
+**       for each byte. A location matches when every masked pattern bit
+**       equals the corresponding memory bit.
+**    2. Candidate locations are Stride bytes apart so a search can be limited
+**       to aligned values.
+**    3. The scan is performed on a RAM buffer. The caller provides either
+**       direct access RAM or a block read with MEMORY_ReadBlock().
+**
+*/
+
+#ifndef _mem_search_
+#define _mem_search_
+
+/*
+** Includes
+*/
+
+#include "app_cfg.h"
+
+
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+
+/*
+** Event Message IDs
+*/
+
+#define MEM_SEARCH_INIT_PATTERN_EID  (MEM_SEARCH_BASE_EID + 0)
+
+#define MEM_SEARCH_NO_ANCHOR  0xFFFF
+
+
+/**********************/
+/** Type Definitions **/
+/**********************/
+
+
+/******************************************************************************
+** Search pattern
+*/
+
+typedef struct
+{
+
+   uint16  Len;
+   uint16  Stride;
+   uint16  Anchor;     // First fully masked byte or MEM_SEARCH_NO_ANCHOR
+   bool    FullMask;   // Every pattern bit is compared
+   uint8   Data[MEM_SEARCH_PATTERN_MAX_LEN];   // Masked pattern
+   uint8   Mask[MEM_SEARCH_PATTERN_MAX_LEN];
+
+} MEM_SEARCH_Pattern_t;
+
+
+/************************/
+/** Exported Functions **/
+/************************/
+
+
+/******************************************************************************
+** Function: MEM_SEARCH_InitPattern
+**
+** Notes:
+**   1. Len must be 1 to MEM_SEARCH_PATTERN_MAX_LEN and Stride must be
+**      non-zero. Error events are sent for invalid parameters.
+**
+*/
+bool MEM_SEARCH_InitPattern(MEM_SEARCH_Pattern_t *Pattern, const uint8 *Data,
+                            const uint8 *Mask, uint16 Len, uint16 Stride);
+
+
+/******************************************************************************
+** Function: MEM_SEARCH_Scan
+**
+** Notes:
+**   1. Scan the candidates at Buf offsets *Pos, *Pos + Stride, ... that are
+**      less than EndPos. The caller must ensure Buf contains Len bytes at
+**      each candidate.
+**   2. Returns true with *Pos set to the first match. Returns false with
+**      *Pos set to the first candidate offset that is >= EndPos so a
+**      search can continue in the next buffer.
+**
+*/
+bool MEM_SEARCH_Scan(const MEM_SEARCH_Pattern_t *Pattern, const uint8 *Buf,
+                     uint32 *Pos, uint32 EndPos);
+
+
+#endif /* _mem_search_ */
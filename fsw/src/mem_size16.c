@@ -188,6 +188,44 @@ bool MEM_SIZE16_ReadBlock(const uint16 *MemAddr, uint16 *DestAddr, uint32 ByteCn
 } /* End MEM_SIZE16_ReadBlock() */
 
 
+/******************************************************************************
+** Function: MEM_SIZE16_ReadRamBlock
+**
+** Notes:
+**   1. The volatile source pointer ensures each location is read with exactly
+**      one 16-bit access. The loop is unrolled to reduce per-value overhead.
+**
+*/
+bool MEM_SIZE16_ReadRamBlock(const uint16 *MemAddr, uint16 *DestAddr, uint32 Cnt)
+{
+#if defined MEM_MGR_OPT_INCL_MEM_SIZE16
+
+   const volatile uint16 *SrcPtr = MemAddr;
+   uint32 i;
+
+   for (i = Cnt / 4; i > 0; i--)
+   {
+      DestAddr[0] = SrcPtr[0];
+      DestAddr[1] = SrcPtr[1];
+      DestAddr[2] = SrcPtr[2];
+      DestAddr[3] = SrcPtr[3];
+      SrcPtr   += 4;
+      DestAddr += 4;
+   }
+
+   for (i = Cnt % 4; i > 0; i--)
+   {
+      *DestAddr++ = *SrcPtr++;
+   }
+
+   return true;
+#else
+   CFE_EVS_SendEvent(MEM_SIZE16_OPT_INCL_EID, CFE_EVS_EventType_ERROR, MEM_MGR_OPT_INCL_MSG);
+   return false;
+#endif
+} /* End MEM_SIZE16_ReadRamBlock() */
+
+
 /******************************************************************************
 ** Function: MEM_SIZE16_VerifyCpuAddr
 **
@@ -265,4 +303,43 @@ bool MEM_SIZE16_WriteBlock(uint16 *MemAddr, const uint16 *SrcAddr, uint32 ByteCn
    CFE_EVS_SendEvent(MEM_SIZE16_OPT_INCL_EID, CFE_EVS_EventType_ERROR, MEM_MGR_OPT_INCL_MSG);
    return false;
 #endif
-} /* End MEM_SIZE16_WriteBlock() */
\ No newline at end of file
+} /* End MEM_SIZE16_WriteBlock() */
+
+
+/******************************************************************************
+** Function: MEM_SIZE16_WriteRamBlock
+**
+** Notes:
+**   1. The volatile destination pointer ensures each location is written with
+**      exactly one 16-bit access. The loop is unrolled to reduce per-value
+**      overhead.
+**
+*/
+bool MEM_SIZE16_WriteRamBlock(uint16 *MemAddr, const uint16 *SrcData, uint32 Cnt)
+{
+#if defined MEM_MGR_OPT_INCL_MEM_SIZE16
+
+   volatile uint16 *DestPtr = MemAddr;
+   uint32 i;
+
+   for (i = Cnt / 4; i > 0; i--)
+   {
+      DestPtr[0] = SrcData[0];
+      DestPtr[1] = SrcData[1];
+      DestPtr[2] = SrcData[2];
+      DestPtr[3] = SrcData[3];
+      DestPtr += 4;
+      SrcData += 4;
+   }
+
+   for (i = Cnt % 4; i > 0; i--)
+   {
+      *DestPtr++ = *SrcData++;
+   }
+
+   return true;
+#else
+   CFE_EVS_SendEvent(MEM_SIZE16_OPT_INCL_EID, CFE_EVS_EventType_ERROR, MEM_MGR_OPT_INCL_MSG);
+   return false;
+#endif
+} /* End MEM_SIZE16_WriteRamBlock() */
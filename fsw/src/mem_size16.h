@@ -84,6 +84,17 @@ bool MEM_SIZE16_Poke(uint16 *MemAddr, MEM_MGR_MemType_Enum_t MemType, const char
 bool MEM_SIZE16_ReadBlock(const uint16 *MemAddr, uint16 *DestAddr, uint32 ByteCnt);
 
 
+/******************************************************************************
+** Function: MEM_SIZE16_ReadRamBlock
+**
+** Notes:
+**   1. Read Cnt 16-bit values directly from RAM without PSP calls. MemAddr
+**      must be a verified RAM address that is not memory mapped I/O.
+**
+*/
+bool MEM_SIZE16_ReadRamBlock(const uint16 *MemAddr, uint16 *DestAddr, uint32 Cnt);
+
+
 /******************************************************************************
 ** Function: MEM_SIZE16_VerifyCpuAddr
 **
@@ -98,4 +109,16 @@ bool MEM_SIZE16_VerifyCpuAddr(uint16 *MemAddr, uint32 PspMemType, const char *Me
 bool MEM_SIZE16_WriteBlock(uint16 *MemAddr, const uint16 *SrcAddr, uint32 ByteCnt);
 
 
+/******************************************************************************
+** Function: MEM_SIZE16_WriteRamBlock
+**
+** Notes:
+**   1. Write Cnt 16-bit values directly to RAM without PSP calls. MemAddr
+**      must be a verified RAM address that is not memory mapped I/O.
+**
+*/
+bool MEM_SIZE16_WriteRamBlock(uint16 *MemAddr, const uint16 *SrcData, uint32 Cnt);
+
+
+
 #endif /* _mem_size16_ */
@@ -191,6 +191,44 @@ bool MEM_SIZE32_ReadBlock(const uint32 *MemAddr, uint32* DestAddr, uint32 ByteCn
 
 
 
+/******************************************************************************
+** Function: MEM_SIZE32_ReadRamBlock
+**
+** Notes:
+**   1. The volatile source pointer ensures each location is read with exactly
+**      one 32-bit access. The loop is unrolled to reduce per-value overhead.
+**
+*/
+bool MEM_SIZE32_ReadRamBlock(const uint32 *MemAddr, uint32 *DestAddr, uint32 Cnt)
+{
+#if defined MEM_MGR_OPT_INCL_MEM_SIZE32
+
+   const volatile uint32 *SrcPtr = MemAddr;
+   uint32 i;
+
+   for (i = Cnt / 4; i > 0; i--)
+   {
+      DestAddr[0] = SrcPtr[0];
+      DestAddr[1] = SrcPtr[1];
+      DestAddr[2] = SrcPtr[2];
+      DestAddr[3] = SrcPtr[3];
+      SrcPtr   += 4;
+      DestAddr += 4;
+   }
+
+   for (i = Cnt % 4; i > 0; i--)
+   {
+      *DestAddr++ = *SrcPtr++;
+   }
+
+   return true;
+#else
+   CFE_EVS_SendEvent(MEM_SIZE32_OPT_INCL_EID, CFE_EVS_EventType_ERROR, MEM_MGR_OPT_INCL_MSG);
+   return false;
+#endif
+} /* End MEM_SIZE32_ReadRamBlock() */
+
+
 /******************************************************************************
 ** Function: MEM_SIZE32_VerifyCpuAddr
 **
@@ -267,4 +305,43 @@ bool MEM_SIZE32_WriteBlock(uint32 *MemAddr, const uint32 *SrcAddr, uint32 ByteCn
    CFE_EVS_SendEvent(MEM_SIZE32_OPT_INCL_EID, CFE_EVS_EventType_ERROR, MEM_MGR_OPT_INCL_MSG);
    return false;
 #endif  
-} /* End MEM_SIZE32_WriteBlock() */
\ No newline at end of file
+} /* End MEM_SIZE32_WriteBlock() */
+
+
+/******************************************************************************
+** Function: MEM_SIZE32_WriteRamBlock
+**
+** Notes:
+**   1. The volatile destination pointer ensures each location is written with
+**      exactly one 32-bit access. The loop is unrolled to reduce per-value
+**      overhead.
+**
+*/
+bool MEM_SIZE32_WriteRamBlock(uint32 *MemAddr, const uint32 *SrcData, uint32 Cnt)
+{
+#if defined MEM_MGR_OPT_INCL_MEM_SIZE32
+
+   volatile uint32 *DestPtr = MemAddr;
+   uint32 i;
+
+   for (i = Cnt / 4; i > 0; i--)
+   {
+      DestPtr[0] = SrcData[0];
+      DestPtr[1] = SrcData[1];
+      DestPtr[2] = SrcData[2];
+      DestPtr[3] = SrcData[3];
+      DestPtr += 4;
+      SrcData += 4;
+   }
+
+   for (i = Cnt % 4; i > 0; i--)
+   {
+      *DestPtr++ = *SrcData++;
+   }
+
+   return true;
+#else
+   CFE_EVS_SendEvent(MEM_SIZE32_OPT_INCL_EID, CFE_EVS_EventType_ERROR, MEM_MGR_OPT_INCL_MSG);
+   return false;
+#endif
+} /* End MEM_SIZE32_WriteRamBlock() */
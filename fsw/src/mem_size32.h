@@ -86,6 +86,17 @@ bool MEM_SIZE32_Poke(uint32 *MemAddr, MEM_MGR_MemType_Enum_t MemType, const char
 bool MEM_SIZE32_ReadBlock(const uint32 *MemAddr, uint32 *DestAddr, uint32 ByteCnt);
 
 
+/******************************************************************************
+** Function: MEM_SIZE32_ReadRamBlock
+**
+** Notes:
+**   1. Read Cnt 32-bit values directly from RAM without PSP calls. MemAddr
+**      must be a verified RAM address that is not memory mapped I/O.
+**
+*/
+bool MEM_SIZE32_ReadRamBlock(const uint32 *MemAddr, uint32 *DestAddr, uint32 Cnt);
+
+
 /******************************************************************************
 ** Function: MEM_SIZE32_VerifyCpuAddr
 **
@@ -100,4 +111,16 @@ bool MEM_SIZE32_VerifyCpuAddr(uint32 *MemAddr, uint32 PspMemType, const char *Me
 bool MEM_SIZE32_WriteBlock(uint32 *MemAddr, const uint32 *SrcData, uint32 ByteCnt);
 
 
+/******************************************************************************
+** Function: MEM_SIZE32_WriteRamBlock
+**
+** Notes:
+**   1. Write Cnt 32-bit values directly to RAM without PSP calls. MemAddr
+**      must be a verified RAM address that is not memory mapped I/O.
+**
+*/
+bool MEM_SIZE32_WriteRamBlock(uint32 *MemAddr, const uint32 *SrcData, uint32 Cnt);
+
+
+
 #endif /* _mem_size32_ */
@@ -193,6 +193,44 @@ bool MEM_SIZE8_ReadBlock(const uint8 *MemAddr, uint8 *DestAddr, uint32 ByteCnt)
 } /* End MEM_SIZE8_ReadBlock() */
 
 
+/******************************************************************************
+** Function: MEM_SIZE8_ReadRamBlock
+**
+** Notes:
+**   1. The volatile source pointer ensures each location is read with exactly
+**      one 8-bit access. The loop is unrolled to reduce per-value overhead.
+**
+*/
+bool MEM_SIZE8_ReadRamBlock(const uint8 *MemAddr, uint8 *DestAddr, uint32 Cnt)
+{
+#if defined MEM_MGR_OPT_INCL_MEM_SIZE8
+
+   const volatile uint8 *SrcPtr = MemAddr;
+   uint32 i;
+
+   for (i = Cnt / 4; i > 0; i--)
+   {
+      DestAddr[0] = SrcPtr[0];
+      DestAddr[1] = SrcPtr[1];
+      DestAddr[2] = SrcPtr[2];
+      DestAddr[3] = SrcPtr[3];
+      SrcPtr   += 4;
+      DestAddr += 4;
+   }
+
+   for (i = Cnt % 4; i > 0; i--)
+   {
+      *DestAddr++ = *SrcPtr++;
+   }
+
+   return true;
+#else
+   CFE_EVS_SendEvent(MEM_SIZE8_OPT_INCL_EID, CFE_EVS_EventType_ERROR, MEM_MGR_OPT_INCL_MSG);
+   return false;
+#endif
+} /* End MEM_SIZE8_ReadRamBlock() */
+
+
 /******************************************************************************
 ** Function: MEM_SIZE8_VerifyCpuAddr
 **
@@ -259,3 +297,43 @@ bool MEM_SIZE8_WriteBlock(uint8 *MemAddr, const uint8 *SrcAddr, uint32 ByteCnt)
    return false;
 #endif
 } /* End MEM_SIZE8_WriteBlock() */
+
+
+/******************************************************************************
+** Function: MEM_SIZE8_WriteRamBlock
+**
+** Notes:
+**   1. The volatile destination pointer ensures each location is written with
+**      exactly one 8-bit access. The loop is unrolled to reduce per-value
+**      overhead.
+**
+*/
+bool MEM_SIZE8_WriteRamBlock(uint8 *MemAddr, const uint8 *SrcData, uint32 Cnt)
+{
+#if defined MEM_MGR_OPT_INCL_MEM_SIZE8
+
+   volatile uint8 *DestPtr = MemAddr;
+   uint32 i;
+
+   for (i = Cnt / 4; i > 0; i--)
+   {
+      DestPtr[0] = SrcData[0];
+      DestPtr[1] = SrcData[1];
+      DestPtr[2] = SrcData[2];
+      DestPtr[3] = SrcData[3];
+      DestPtr += 4;
+      SrcData += 4;
+   }
+
+   for (i = Cnt % 4; i > 0; i--)
+   {
+      *DestPtr++ = *SrcData++;
+   }
+
+   return true;
+#else
+   CFE_EVS_SendEvent(MEM_SIZE8_OPT_INCL_EID, CFE_EVS_EventType_ERROR, MEM_MGR_OPT_INCL_MSG);
+   return false;
+#endif
+} /* End MEM_SIZE8_WriteRamBlock() */
+
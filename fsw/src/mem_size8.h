@@ -86,6 +86,17 @@ bool MEM_SIZE8_Poke(uint8 *MemAddr, MEM_MGR_MemType_Enum_t MemType, const char *
 bool MEM_SIZE8_ReadBlock(const uint8 *MemAddr, uint8 *DestAddr, uint32 ByteCnt);
 
 
+/******************************************************************************
+** Function: MEM_SIZE8_ReadRamBlock
+**
+** Notes:
+**   1. Read Cnt 8-bit values directly from RAM without PSP calls. MemAddr
+**      must be a verified RAM address that is not memory mapped I/O.
+**
+*/
+bool MEM_SIZE8_ReadRamBlock(const uint8 *MemAddr, uint8 *DestAddr, uint32 Cnt);
+
+
 /******************************************************************************
 ** Function: MEM_SIZE8_VerifyCpuAddr
 **
@@ -100,4 +111,16 @@ bool MEM_SIZE8_VerifyCpuAddr(uint8 *MemAddr, uint32 PspMemType, const char *MemT
 bool MEM_SIZE8_WriteBlock(uint8 *MemAddr, const uint8 *SrcAddr, uint32 ByteCnt);
 
 
+/******************************************************************************
+** Function: MEM_SIZE8_WriteRamBlock
+**
+** Notes:
+**   1. Write Cnt 8-bit values directly to RAM without PSP calls. MemAddr
+**      must be a verified RAM address that is not memory mapped I/O.
+**
+*/
+bool MEM_SIZE8_WriteRamBlock(uint8 *MemAddr, const uint8 *SrcData, uint32 Cnt);
+
+
+
 #endif /* _mem_size8_ */
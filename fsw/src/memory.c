@@ -30,24 +30,41 @@
 ** Include Files:
 */
 
+#include <stddef.h>
 #include <string.h>
 
 #include "memory.h"
+#include "mem_crc.h"
+#include "mem_fill.h"
 #include "mem_size8.h"
 #include "mem_size16.h"
 #include "mem_size32.h"
 
 
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+#define PEEK_LIST_MAX_ENTRIES  (sizeof(((MEM_MGR_PeekList_CmdPayload_t *)0)->Entry) / sizeof(MEM_MGR_PeekListEntry_t))
+
+
 /*******************************/
 /** Local Function Prototypes **/
 /*******************************/
 
+static void AddModuleToSignature(osal_id_t ModuleId, void *Signature);
+static void AddSymCacheEntry(const char *SymbolName, uint32 Hash, cpuaddr Addr);
 static bool CreateCpuAddr(MEM_MGR_SymbolAddr_t *SymbolAddr, MEM_MGR_CpuAddr_Atom_t *CpuAddr);
 static bool FillMemBlock(MEM_MGR_CpuAddr_Atom_t DestAddr, MEM_MGR_MemSize_Enum_t MemSize, uint32 FillData, uint32 ByteCnt);
+static MEMORY_SymCacheEntry_t *FindSymCacheEntry(const char *SymbolName, uint32 Hash);
+static void CheckModuleSignature(void);
+static void FlushSymCache(void);
+static uint32 GetModuleSignature(void);
 static bool GetPspMemType(MEM_MGR_MemType_Enum_t MemType, uint32 *PspMemType, char **MemTypeStr);
+static uint32 HashSymbolName(const char *SymbolName);
+static int32 LookupSymbol(cpuaddr *SymbolAddr, const char *SymbolName);
 static bool Peek(MEM_MGR_CpuAddr_Atom_t CpuAddr, MEM_MGR_MemType_Enum_t MemType, const char *MemTypeStr, MEM_MGR_MemSize_Enum_t MemSize);
 static bool Poke(MEM_MGR_CpuAddr_Atom_t CpuAddr, MEM_MGR_MemType_Enum_t MemType, const char *MemTypeStr, MEM_MGR_MemSize_Enum_t MemSize, uint32 Data);
-static bool ReadMemBlock(void *DestAddr, MEM_MGR_CpuAddr_Atom_t SrcCpuAddr, MEM_MGR_MemSize_Enum_t SrcMemSize, uint32 ByteCnt);
 static bool SendDumpBufToEvent(MEM_MGR_CpuAddr_Atom_t CpuAddr, const uint8 *DumpBuf, uint32 ByteCnt);
 static bool VerifyCpuAddr(MEM_MGR_CpuAddr_Atom_t CpuAddr, uint32 PspMemType, const char *MemTypeStr, MEM_MGR_MemSize_Enum_t MemSize, uint32 ByteCnt);
 
@@ -69,20 +86,39 @@ static uint32 DumpToEventBuf[MEMORY_DUMP_TOEVENT_MAX_DWORDS];  // Defined to sup
 ** Function: MEMORY_Constructor
 **
 */
-void MEMORY_Constructor(MEMORY_Class_t *MemoryPtr)
+void MEMORY_Constructor(MEMORY_Class_t *MemoryPtr, const INITBL_Class_t *IniTbl)
 {
  
+   int32 Status;
+   
    Memory = MemoryPtr;
 
    CFE_PSP_MemSet((void*)Memory, 0, sizeof(MEMORY_Class_t));
  
    Memory->EepromWriteEna = false;  //TODO: The hardware has not been commanded
+   Memory->FillChildThreshold = INITBL_GetIntConfig(IniTbl, CFG_MEMORY_FILL_CHILD_THRESHOLD);
    
    // Addr, Data, ByteCnt are zero
    Memory->CmdStatus.Function = MEM_MGR_MemFunction_NONE_PERFORMED;
    Memory->CmdStatus.Type     = MEM_MGR_MemType_UNDEF;
    Memory->CmdStatus.Size     = MEM_MGR_MemSize_UNDEF;
    
+   CFE_MSG_Init(CFE_MSG_PTR(Memory->PeekListTlm.TelemetryHeader),
+                CFE_SB_ValueToMsgId(INITBL_GetIntConfig(IniTbl, CFG_MEM_MGR_PEEK_LIST_TLM_TOPICID)),
+                sizeof(MEM_MGR_PeekListTlm_t));
+
+   Status = OS_MutSemCreate(&Memory->SymCache.MutexId, "MEM_MGR_SYM_CACHE", 0);
+   if (Status == OS_SUCCESS)
+   {
+      Memory->SymCache.Enabled = true;
+      Memory->SymCache.ModuleSignature = GetModuleSignature();
+   }
+   else
+   {
+      CFE_EVS_SendEvent(MEMORY_SYM_CACHE_EID, CFE_EVS_EventType_ERROR,
+                        "Symbol cache disabled, error creating mutex, status=%d", (int)Status);
+   }
+   
 } /* End MEMORY_Constructor() */
 
 
@@ -139,20 +175,29 @@ bool MEMORY_DumpToEventCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
    bool  RetStatus = false;
    MEMORY_VerifiedMemory_t VerifiedMemory;
 
-   RetStatus = MEMORY_VerifyAddr(DumpToEventCmd->SymbolAddr, DumpToEventCmd->MemType, DumpToEventCmd->MemSize,
-                                 DumpToEventCmd->ByteCnt, &VerifiedMemory);
-   if (RetStatus == true)
+   if (DumpToEventCmd->ByteCnt > MEMORY_DUMP_TOEVENT_MAX_BYTES)
    {
-         
-      RetStatus = ReadMemBlock(DumpToEventBuf, VerifiedMemory.CpuAddr,  
-                               DumpToEventCmd->MemSize, DumpToEventCmd->ByteCnt);
-
+      CFE_EVS_SendEvent(MEMORY_DUMP_TO_EVENT_EID, CFE_EVS_EventType_ERROR,
+                        "Dump to event rejected, byte count %u exceeds the %u byte maximum. Use the dump to telemetry command.",
+                        (unsigned int)DumpToEventCmd->ByteCnt, (unsigned int)MEMORY_DUMP_TOEVENT_MAX_BYTES);
+   }
+   else
+   {
+      RetStatus = MEMORY_VerifyAddr(DumpToEventCmd->SymbolAddr, DumpToEventCmd->MemType, DumpToEventCmd->MemSize,
+                                    DumpToEventCmd->ByteCnt, MEM_MAP_ACCESS_READ, &VerifiedMemory);
       if (RetStatus == true)
       {
-         RetStatus = SendDumpBufToEvent(VerifiedMemory.CpuAddr, (const uint8*)DumpToEventBuf, DumpToEventCmd->ByteCnt);
-      }
-      
-   } /* End MEMORY_VerifyAddr()*/
+            
+         RetStatus = MEMORY_ReadBlock(DumpToEventBuf, VerifiedMemory.CpuAddr,  
+                                      DumpToEventCmd->MemSize, DumpToEventCmd->ByteCnt, VerifiedMemory.DirectAccess);
+
+         if (RetStatus == true)
+         {
+            RetStatus = SendDumpBufToEvent(VerifiedMemory.CpuAddr, (const uint8*)DumpToEventBuf, DumpToEventCmd->ByteCnt);
+         }
+         
+      } /* End MEMORY_VerifyAddr()*/
+   }
 
    if (RetStatus == true)
    {
@@ -209,7 +254,10 @@ bool MEMORY_EnaEepromWriteCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
 ** Function: MEMORY_FillCmd
 **
 ** Notes:
-**   None
+**   1. Direct access RAM is filled by MEM_FILL, all other memory is filled
+**      one PSP write at a time.
+**   2. Large fills are passed to the child task so the app's main loop isn't
+**      blocked.
 **
 */
 bool MEMORY_FillCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
@@ -219,34 +267,73 @@ bool MEMORY_FillCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
  
    bool RetStatus = false;
    MEMORY_VerifiedMemory_t VerifiedMemory;
+   MEM_FILL_Pattern_t      FillPattern;
    
-   RetStatus = MEMORY_VerifyAddr(FillCmd->SymbolAddr, FillCmd->MemType, FillCmd->MemSize,
-                                 FillCmd->ByteCnt, &VerifiedMemory);
-   if (RetStatus == true)
-   {   
-      RetStatus = FillMemBlock(VerifiedMemory.CpuAddr, FillCmd->MemSize, FillCmd->Data, FillCmd->ByteCnt);
+   if (FillCmd->ByteCnt > Memory->FillChildThreshold)
+   {
+      RetStatus = CHILDMGR_InvokeChildCmd(DataObjPtr, MsgPtr);
+   }
+   else
+   {
+      RetStatus = MEMORY_VerifyAddr(FillCmd->SymbolAddr, FillCmd->MemType, FillCmd->MemSize,
+                                    FillCmd->ByteCnt, MEM_MAP_ACCESS_WRITE, &VerifiedMemory);
       if (RetStatus == true)
-      {
-         Memory->CmdStatus.Function = MEM_MGR_MemFunction_FILL;
-         Memory->CmdStatus.Type     = FillCmd->MemType;
-         Memory->CmdStatus.Size     = FillCmd->MemSize;
-         Memory->CmdStatus.Addr     = VerifiedMemory.CpuAddr;
-         Memory->CmdStatus.Data     = FillCmd->Data;
-         Memory->CmdStatus.ByteCnt  = FillCmd->ByteCnt;
+      {   
+         if (VerifiedMemory.DirectAccess)
+         {
+            MEM_FILL_InitValue(&FillPattern, FillCmd->MemSize, FillCmd->Data);
+            RetStatus = MEM_FILL_Write(&FillPattern, VerifiedMemory.CpuAddr, FillCmd->ByteCnt, true);
+         }
+         else
+         {
+            RetStatus = FillMemBlock(VerifiedMemory.CpuAddr, FillCmd->MemSize, FillCmd->Data, FillCmd->ByteCnt);
+         }
+         if (RetStatus == true)
+         {
+            Memory->CmdStatus.Function = MEM_MGR_MemFunction_FILL;
+            Memory->CmdStatus.Type     = FillCmd->MemType;
+            Memory->CmdStatus.Size     = FillCmd->MemSize;
+            Memory->CmdStatus.Addr     = VerifiedMemory.CpuAddr;
+            Memory->CmdStatus.Data     = FillCmd->Data;
+            Memory->CmdStatus.ByteCnt  = FillCmd->ByteCnt;
 
-         CFE_EVS_SendEvent(MEMORY_FILL_CMD_EID, CFE_EVS_EventType_INFORMATION,
-                           "Successfully filled %d bytes of memory with %d starting at %p", 
-                           (int)FillCmd->ByteCnt, FillCmd->Data, (void *)VerifiedMemory.CpuAddr);
+            CFE_EVS_SendEvent(MEMORY_FILL_CMD_EID, CFE_EVS_EventType_INFORMATION,
+                              "Successfully filled %d bytes of memory with %d starting at %p", 
+                              (int)FillCmd->ByteCnt, FillCmd->Data, (void *)VerifiedMemory.CpuAddr);
 
-      }
+         }
       
-   } /* End MEMORY_VerifyAddr()*/
+      } /* End MEMORY_VerifyAddr()*/
+   } /* End if not a child task fill */
    
    return RetStatus;
    
 } /* MEMORY_FillCmd() */
 
 
+/******************************************************************************
+** Function: MEMORY_FlushSymCacheCmd
+**
+*/
+bool MEMORY_FlushSymCacheCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
+{
+
+   if (Memory->SymCache.Enabled)
+   {
+      OS_MutSemTake(Memory->SymCache.MutexId);
+      FlushSymCache();
+      OS_MutSemGive(Memory->SymCache.MutexId);
+   }
+
+   CFE_EVS_SendEvent(MEMORY_SYM_CACHE_EID, CFE_EVS_EventType_INFORMATION,
+                     "Flushed symbol cache. Hit count %u, miss count %u",
+                     (unsigned int)Memory->SymCache.HitCnt, (unsigned int)Memory->SymCache.MissCnt);
+
+   return true;
+
+} /* End MEMORY_FlushSymCacheCmd() */
+
+
 /******************************************************************************
 ** Function: MEMORY_LoadWithIntDisCmd
 **
@@ -265,13 +352,20 @@ bool MEMORY_LoadWithIntDisCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
    MEMORY_VerifiedMemory_t VerifiedMemory;
    
    RetStatus = MEMORY_VerifyAddr(LoadWithIntDisCmd->SymbolAddr, LoadWithIntDisCmd->MemType, LoadWithIntDisCmd->MemSize,
-                                 LoadWithIntDisCmd->ByteCnt, &VerifiedMemory);
+                                 LoadWithIntDisCmd->ByteCnt, MEM_MAP_ACCESS_WRITE, &VerifiedMemory);
    if (RetStatus == true)
    {
-         
-      ComputedCRC = CFE_ES_CalculateCRC(LoadWithIntDisCmd->Data, LoadWithIntDisCmd->ByteCnt, 0, LoadWithIntDisCmd->CrcType);
+      
+      RetStatus = false;   
+      ComputedCRC = MEM_CRC_Calculate(LoadWithIntDisCmd->Data, LoadWithIntDisCmd->ByteCnt, 0, LoadWithIntDisCmd->CrcType);
 
-      if (ComputedCRC == LoadWithIntDisCmd->Crc)
+      if (!MEM_CRC_ValidType(LoadWithIntDisCmd->CrcType))
+      {
+         CFE_EVS_SendEvent(MEMORY_LOAD_INT_DIS_EID, CFE_EVS_EventType_ERROR,
+                           "Load memory with interrupts disabled invalid CRC type %d. See mem_mgr.xml CrcType for valid types.",
+                           LoadWithIntDisCmd->CrcType);
+      }
+      else if (ComputedCRC == LoadWithIntDisCmd->Crc)
       {
 
          PspStatus = CFE_PSP_MemCpy((void*)VerifiedMemory.CpuAddr, (void*)LoadWithIntDisCmd->Data, LoadWithIntDisCmd->ByteCnt);
@@ -363,6 +457,79 @@ OS_printf("Cmd Symbol: %s, Local Symbol: %s\n",LookupSymbolCmd->Name,SymbolName)
 } /* End MEMORY_LookupSymbolCmd() */
 
 
+/******************************************************************************
+** Function: MEMORY_ManageSymCache
+**
+*/
+void MEMORY_ManageSymCache(void)
+{
+
+   if (Memory->SymCache.Enabled)
+   {
+      OS_MutSemTake(Memory->SymCache.MutexId);
+      CheckModuleSignature();
+      OS_MutSemGive(Memory->SymCache.MutexId);
+   }
+
+} /* End MEMORY_ManageSymCache() */
+
+
+/******************************************************************************
+** Function: MEMORY_PatternFillCmd
+**
+** Notes:
+**   1. MEM_FILL sends detailed pattern error events.
+**   2. The seed is reported as the command status data.
+**   3. Large fills are passed to the child task so the app's main loop isn't
+**      blocked.
+**
+*/
+bool MEMORY_PatternFillCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
+{
+
+   const MEM_MGR_PatternFill_CmdPayload_t *FillCmd = CMDMGR_PAYLOAD_PTR(MsgPtr, MEM_MGR_PatternFill_t);
+ 
+   bool RetStatus = false;
+   MEMORY_VerifiedMemory_t VerifiedMemory;
+   MEM_FILL_Pattern_t      FillPattern;
+   
+   if (FillCmd->ByteCnt > Memory->FillChildThreshold)
+   {
+      RetStatus = CHILDMGR_InvokeChildCmd(DataObjPtr, MsgPtr);
+   }
+   else
+   {
+      if (MEM_FILL_InitPattern(&FillPattern, FillCmd->Pattern, FillCmd->MemSize,
+                               (const uint8 *)FillCmd->Data, FillCmd->PatternLen, FillCmd->Seed))
+      {
+         if (MEMORY_VerifyAddr(FillCmd->SymbolAddr, FillCmd->MemType, FillCmd->MemSize,
+                               FillCmd->ByteCnt, MEM_MAP_ACCESS_WRITE, &VerifiedMemory))
+         {   
+            RetStatus = MEM_FILL_Write(&FillPattern, VerifiedMemory.CpuAddr, FillCmd->ByteCnt,
+                                       VerifiedMemory.DirectAccess);
+            if (RetStatus == true)
+            {
+               Memory->CmdStatus.Function = MEM_MGR_MemFunction_PATTERN_FILL;
+               Memory->CmdStatus.Type     = FillCmd->MemType;
+               Memory->CmdStatus.Size     = FillCmd->MemSize;
+               Memory->CmdStatus.Addr     = VerifiedMemory.CpuAddr;
+               Memory->CmdStatus.Data     = FillCmd->Seed;
+               Memory->CmdStatus.ByteCnt  = FillCmd->ByteCnt;
+
+               CFE_EVS_SendEvent(MEMORY_PATTERN_FILL_EID, CFE_EVS_EventType_INFORMATION,
+                                 "Successfully filled %u bytes of memory with pattern %d starting at %p", 
+                                 (unsigned int)FillCmd->ByteCnt, FillCmd->Pattern, (void *)VerifiedMemory.CpuAddr);
+            }
+      
+         } /* End MEMORY_VerifyAddr()*/
+      } /* End MEM_FILL_InitPattern() */
+   } /* End if not a child task fill */
+   
+   return RetStatus;
+   
+} /* MEMORY_PatternFillCmd() */
+
+
 /******************************************************************************
 ** Function: MEMORY_PeekCmd
 **
@@ -383,7 +550,7 @@ bool MEMORY_PeekCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
 
    // MemSize enumeration value is used for the number of bytes parameter
    RetStatus = MEMORY_VerifyAddr(PeekCmd->SymbolAddr, PeekCmd->MemType, PeekCmd->MemSize,
-                                 PeekCmd->MemSize, &VerifiedMemory);
+                                 PeekCmd->MemSize, MEM_MAP_ACCESS_READ, &VerifiedMemory);
    if (RetStatus == true)
    {
       RetStatus = Peek(VerifiedMemory.CpuAddr, PeekCmd->MemType, VerifiedMemory.TypeStr, PeekCmd->MemSize);
@@ -400,6 +567,145 @@ bool MEMORY_PeekCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
 } /* End MEMORY_PeekCmd() */
 
 
+/******************************************************************************
+** Function: MEMORY_PeekListCmd
+**
+** Notes:
+**   1. MEMORY_VerifyAddr() resolves symbols and sends verification error
+**      events so no events are sent while the entries are read.
+**   2. A PSP read error is reported after the interrupt lock is released and
+**      the telemetry packet is not sent.
+**   3. An interrupt lock request is rejected if the platform doesn't define
+**      MEM_MGR_OPT_INCL_INT_LOCK so IntLock is only reported when the lock
+**      was taken.
+**   4. The command status ByteCnt is the total number of bytes read. The
+**      8, 16 and 32 MemSize values are the number of bytes.
+**
+*/
+bool MEMORY_PeekListCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
+{
+
+   const MEM_MGR_PeekList_CmdPayload_t *PeekListCmd = CMDMGR_PAYLOAD_PTR(MsgPtr, MEM_MGR_PeekList_t);
+   MEM_MGR_PeekListTlm_Payload_t *Payload = &Memory->PeekListTlm.Payload;
+
+   bool    RetStatus = true;
+   bool    DirectAccess[PEEK_LIST_MAX_ENTRIES];
+   uint16  i;
+   uint16  EntryCnt = PeekListCmd->EntryCnt;
+   uint32  ByteCnt  = 0;
+#if defined MEM_MGR_OPT_INCL_INT_LOCK
+   uint32  IntKey   = 0;
+#endif
+   int32   PspStatus = CFE_PSP_SUCCESS;
+   const MEM_MGR_PeekListEntry_t *Entry;
+   MEMORY_VerifiedMemory_t VerifiedMemory;
+
+   if (EntryCnt == 0 || EntryCnt > PEEK_LIST_MAX_ENTRIES)
+   {
+      CFE_EVS_SendEvent(MEMORY_PEEK_LIST_EID, CFE_EVS_EventType_ERROR,
+                        "Peek list command rejected, entry count %d must be between 1 and %d",
+                        EntryCnt, (int)PEEK_LIST_MAX_ENTRIES);
+      RetStatus = false;
+   }
+#if !defined MEM_MGR_OPT_INCL_INT_LOCK
+   else if (PeekListCmd->IntLock)
+   {
+      CFE_EVS_SendEvent(MEMORY_PEEK_LIST_EID, CFE_EVS_EventType_ERROR,
+                        "Peek list command rejected, interrupt lock requested but MEM_MGR_OPT_INCL_INT_LOCK is not defined for this platform");
+      RetStatus = false;
+   }
+#endif
+
+   for (i=0; (i < EntryCnt) && RetStatus; i++)
+   {
+      Entry = &PeekListCmd->Entry[i];
+
+      // MemSize enumeration value is used for the number of bytes parameter
+      RetStatus = MEMORY_VerifyAddr(Entry->SymbolAddr, Entry->MemType, Entry->MemSize,
+                                    Entry->MemSize, MEM_MAP_ACCESS_READ, &VerifiedMemory);
+      if (RetStatus == true)
+      {
+         if (Entry->MemSize == MEM_MGR_MemSize_VOID)
+         {
+            CFE_EVS_SendEvent(MEMORY_PEEK_LIST_EID, CFE_EVS_EventType_ERROR,
+                              "Peek list command rejected, entry %d memory size must be 8, 16 or 32 bits", i);
+            RetStatus = false;
+         }
+         else
+         {
+            Payload->Value[i].CpuAddr = VerifiedMemory.CpuAddr;
+            Payload->Value[i].MemType = Entry->MemType;
+            Payload->Value[i].MemSize = Entry->MemSize;
+            Payload->Value[i].Spare   = 0;
+            DirectAccess[i] = VerifiedMemory.DirectAccess;
+            ByteCnt += Entry->MemSize;
+         }
+      }
+      else
+      {
+         CFE_EVS_SendEvent(MEMORY_PEEK_LIST_EID, CFE_EVS_EventType_ERROR,
+                           "Peek list command rejected, entry %d address verification failed", i);
+      }
+   } /* End verify loop */
+
+   if (RetStatus == true)
+   {
+#if defined MEM_MGR_OPT_INCL_INT_LOCK
+      if (PeekListCmd->IntLock)
+      {
+         IntKey = MEM_MGR_INT_LOCK();
+      }
+#endif
+
+      for (i=0; (i < EntryCnt) && (PspStatus == CFE_PSP_SUCCESS); i++)
+      {
+         PspStatus = MEMORY_ReadValue(Payload->Value[i].CpuAddr, Payload->Value[i].MemSize,
+                                      DirectAccess[i], &Payload->Value[i].Value);
+      }
+
+#if defined MEM_MGR_OPT_INCL_INT_LOCK
+      if (PeekListCmd->IntLock)
+      {
+         MEM_MGR_INT_UNLOCK(IntKey);
+      }
+#endif
+
+      if (PspStatus == CFE_PSP_SUCCESS)
+      {
+         Payload->EntryCnt = EntryCnt;
+         Payload->IntLock  = PeekListCmd->IntLock;
+         Payload->Spare    = 0;
+
+         CFE_MSG_SetSize(CFE_MSG_PTR(Memory->PeekListTlm.TelemetryHeader),
+                         offsetof(MEM_MGR_PeekListTlm_t, Payload.Value) + EntryCnt * sizeof(MEM_MGR_PeekListValue_t));
+         CFE_SB_TimeStampMsg(CFE_MSG_PTR(Memory->PeekListTlm.TelemetryHeader));
+         CFE_SB_TransmitMsg(CFE_MSG_PTR(Memory->PeekListTlm.TelemetryHeader), true);
+
+         Memory->CmdStatus.Function = MEM_MGR_MemFunction_PEEK_LIST;
+         Memory->CmdStatus.Type     = Payload->Value[0].MemType;
+         Memory->CmdStatus.Size     = Payload->Value[0].MemSize;
+         Memory->CmdStatus.Addr     = Payload->Value[0].CpuAddr;
+         Memory->CmdStatus.Data     = Payload->Value[0].Value;
+         Memory->CmdStatus.ByteCnt  = ByteCnt;
+
+         CFE_EVS_SendEvent(MEMORY_PEEK_LIST_EID, CFE_EVS_EventType_INFORMATION,
+                           "Peek list read %d memory locations%s", EntryCnt,
+                           PeekListCmd->IntLock ? " with interrupts locked" : "");
+      }
+      else
+      {
+         CFE_EVS_SendEvent(MEMORY_PEEK_LIST_EID, CFE_EVS_EventType_ERROR,
+                           "Peek list command failed reading entry %d at address %p, status=0x%08X",
+                           i-1, (void *)Payload->Value[i-1].CpuAddr, (unsigned int)PspStatus);
+         RetStatus = false;
+      }
+   } /* End if all entries verified */
+
+   return RetStatus;
+
+} /* End MEMORY_PeekListCmd() */
+
+
 /******************************************************************************
 ** Function: MEMORY_PokeCmd
 **
@@ -418,7 +724,7 @@ bool MEMORY_PokeCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
 
    // MemSize enumeration value is used for the number of bytes parameter
    RetStatus = MEMORY_VerifyAddr(PokeCmd->SymbolAddr, PokeCmd->MemType, PokeCmd->MemSize,
-                                 PokeCmd->MemSize, &VerifiedMemory);
+                                 PokeCmd->MemSize, MEM_MAP_ACCESS_WRITE, &VerifiedMemory);
    if (RetStatus == true)
    {
       RetStatus = Poke(VerifiedMemory.CpuAddr, PokeCmd->MemType, VerifiedMemory.TypeStr, PokeCmd->MemSize, PokeCmd->Data);
@@ -434,13 +740,146 @@ bool MEMORY_PokeCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
 } /* End MEMORY_PokeCmd() */
 
 
+/******************************************************************************
+** Function: MEMORY_ReadBlock
+**
+** Notes:
+**   1. Copy a block of memory from a memory type/size to a local RAM buffer.
+**      This function is typically used for commanded memory types/sizes.
+**   2. From an OO design perspective this is a virtual function dispatcher
+**   3. DirectAccess RAM is read with width preserving loads that bypass the
+**      per-element PSP calls.
+**
+*/
+bool MEMORY_ReadBlock(void *DestAddr, MEM_MGR_CpuAddr_Atom_t SrcCpuAddr,  
+                      MEM_MGR_MemSize_Enum_t SrcMemSize, uint32 ByteCnt, bool DirectAccess)
+{
+
+   bool   RetStatus = false;
+   int32  PspStatus;
+   
+   switch (SrcMemSize)
+   {
+      case MEM_MGR_MemSize_8:
+         if (DirectAccess)
+         {
+            RetStatus = MEM_SIZE8_ReadRamBlock((const uint8*)SrcCpuAddr, (uint8*)DestAddr, ByteCnt);
+         }
+         else
+         {
+            RetStatus = MEM_SIZE8_ReadBlock((uint8*)SrcCpuAddr, (uint8*)DestAddr, ByteCnt);
+         }
+         break;
+      case MEM_MGR_MemSize_16:
+         if (DirectAccess)
+         {
+            RetStatus = MEM_SIZE16_ReadRamBlock((const uint16*)SrcCpuAddr, (uint16*)DestAddr, ByteCnt/2);
+         }
+         else
+         {
+            RetStatus = MEM_SIZE16_ReadBlock((uint16*)SrcCpuAddr, (uint16*)DestAddr, ByteCnt/2);
+         }
+         break;
+      case MEM_MGR_MemSize_32:
+         if (DirectAccess)
+         {
+            RetStatus = MEM_SIZE32_ReadRamBlock((const uint32*)SrcCpuAddr, (uint32*)DestAddr, ByteCnt/4);
+         }
+         else
+         {
+            RetStatus = MEM_SIZE32_ReadBlock((uint32*)SrcCpuAddr, (uint32*)DestAddr, ByteCnt/4);
+         }
+         break;
+      case MEM_MGR_MemSize_VOID:
+         PspStatus = CFE_PSP_MemCpy((void*)DestAddr, (void*)SrcCpuAddr, ByteCnt);
+         RetStatus = (PspStatus == CFE_PSP_SUCCESS);
+         if (!RetStatus)
+         {
+            CFE_EVS_SendEvent(MEMORY_READ_BLOCK_EID, CFE_EVS_EventType_ERROR,
+                              "Read block memory copy failed for source address %p, byte count %u, status=0x%08X",
+                              (void *)SrcCpuAddr, (unsigned int)ByteCnt, (unsigned int)PspStatus);
+         }
+         break;
+      default:
+         CFE_EVS_SendEvent(MEMORY_READ_BLOCK_EID, CFE_EVS_EventType_ERROR,
+                           "Read block failed for source address %p, invalid memory size %d",
+                           (void *)SrcCpuAddr, SrcMemSize);
+         break;
+   } /* End mem size switch */
+
+   return RetStatus;
+    
+} /* End MEMORY_ReadBlock() */
+
+
+/******************************************************************************
+** Function: MEMORY_ReadValue
+**
+** Notes:
+**   1. Direct access reads use a single volatile load of the memory width.
+**
+*/
+int32 MEMORY_ReadValue(MEM_MGR_CpuAddr_Atom_t CpuAddr, MEM_MGR_MemSize_Enum_t MemSize,
+                       bool DirectAccess, uint32 *Value)
+{
+
+   int32  PspStatus = CFE_PSP_SUCCESS;
+   uint8  Value8  = 0;
+   uint16 Value16 = 0;
+
+   switch (MemSize)
+   {
+      case MEM_MGR_MemSize_8:
+         if (DirectAccess)
+         {
+            Value8 = *((volatile uint8 *)CpuAddr);
+         }
+         else
+         {
+            PspStatus = CFE_PSP_MemRead8(CpuAddr, &Value8);
+         }
+         *Value = Value8;
+         break;
+      case MEM_MGR_MemSize_16:
+         if (DirectAccess)
+         {
+            Value16 = *((volatile uint16 *)CpuAddr);
+         }
+         else
+         {
+            PspStatus = CFE_PSP_MemRead16(CpuAddr, &Value16);
+         }
+         *Value = Value16;
+         break;
+      case MEM_MGR_MemSize_32:
+         if (DirectAccess)
+         {
+            *Value = *((volatile uint32 *)CpuAddr);
+         }
+         else
+         {
+            PspStatus = CFE_PSP_MemRead32(CpuAddr, Value);
+         }
+         break;
+      default:
+         PspStatus = CFE_PSP_ERROR;
+         break;
+   } /* End mem size switch */
+
+   return PspStatus;
+
+} /* End MEMORY_ReadValue() */
+
+
 /******************************************************************************
 ** Function:  MEMORY_ResetStatus
 **
 */
 void MEMORY_ResetStatus(void)
 {
-   //TODO: Should anything be reset?
+
+   Memory->SymCache.HitCnt  = 0;
+   Memory->SymCache.MissCnt = 0;
    
 } /* End MEMORY_ResetStatus() */
 
@@ -472,16 +911,18 @@ void MEMORY_SetCmdStatus(const MEMORY_CmdStatus_t *CmdStatus)
 **
 */
 bool MEMORY_VerifyAddr(MEM_MGR_SymbolAddr_t SymbolAddr, MEM_MGR_MemType_Enum_t MemType,
-                       MEM_MGR_MemSize_Enum_t MemSize, uint32 ByteCnt, 
+                       MEM_MGR_MemSize_Enum_t MemSize, uint32 ByteCnt, uint8 Access,
                        MEMORY_VerifiedMemory_t *VerifiedMemory)
 {
    
    bool                  RetStatus = false;
    MEM_MGR_SymbolAddr_t  LocalSymbolAddr;
    uint32                PspMemType;
+   bool                  Mmio = false;
 
    VerifiedMemory->CpuAddr = 0;
    VerifiedMemory->TypeStr = MEM_TYPE_UNDEF;
+   VerifiedMemory->DirectAccess = false;
    
    // Create local SymbolAddr copy since it may get modified
    LocalSymbolAddr = SymbolAddr;
@@ -494,7 +935,16 @@ bool MEMORY_VerifyAddr(MEM_MGR_SymbolAddr_t SymbolAddr, MEM_MGR_MemType_Enum_t M
       if (RetStatus == true)
       {
          
-         RetStatus = VerifyCpuAddr(VerifiedMemory->CpuAddr, PspMemType, VerifiedMemory->TypeStr, MemSize, ByteCnt);
+         if (MEM_MAP_Enabled())
+         {
+            RetStatus = MEM_MAP_VerifyAddr(VerifiedMemory->CpuAddr, ByteCnt, MemType, MemSize, Access, &Mmio);
+         }
+         else
+         {
+            RetStatus = VerifyCpuAddr(VerifiedMemory->CpuAddr, PspMemType, VerifiedMemory->TypeStr, MemSize, ByteCnt);
+         }
+         
+         VerifiedMemory->DirectAccess = (RetStatus && (MemType == MEM_MGR_MemType_RAM) && !Mmio);
 
       } /* End if got PSP mem type */
 
@@ -505,6 +955,131 @@ bool MEMORY_VerifyAddr(MEM_MGR_SymbolAddr_t SymbolAddr, MEM_MGR_MemType_Enum_t M
 } /* End MEMORY_VerifyAddr() */
 
 
+/******************************************************************************
+** Function: MEMORY_WriteBlock
+**
+** Notes:
+**   1. Copy a block of data from a local RAM buffer to a memory type/size.
+**   2. From an OO design perspective this is a virtual function dispatcher
+**   3. DirectAccess RAM is written with width preserving stores that bypass
+**      the per-element PSP calls.
+**
+*/
+bool MEMORY_WriteBlock(MEM_MGR_CpuAddr_Atom_t DestCpuAddr, MEM_MGR_MemSize_Enum_t DestMemSize,
+                       const void *SrcAddr, uint32 ByteCnt, bool DirectAccess)
+{
+   
+   bool   RetStatus = false;
+   int32  PspStatus;
+   
+   switch (DestMemSize)
+   {
+      case MEM_MGR_MemSize_8:
+         if (DirectAccess)
+         {
+            RetStatus = MEM_SIZE8_WriteRamBlock((uint8*)DestCpuAddr, (const uint8*)SrcAddr, ByteCnt);
+         }
+         else
+         {
+            RetStatus = MEM_SIZE8_WriteBlock((uint8*)DestCpuAddr, (const uint8*)SrcAddr, ByteCnt);
+         }
+         break;
+      case MEM_MGR_MemSize_16:
+         if (DirectAccess)
+         {
+            RetStatus = MEM_SIZE16_WriteRamBlock((uint16*)DestCpuAddr, (const uint16*)SrcAddr, ByteCnt/2);
+         }
+         else
+         {
+            RetStatus = MEM_SIZE16_WriteBlock((uint16*)DestCpuAddr, (const uint16*)SrcAddr, ByteCnt/2);
+         }
+         break;
+      case MEM_MGR_MemSize_32:
+         if (DirectAccess)
+         {
+            RetStatus = MEM_SIZE32_WriteRamBlock((uint32*)DestCpuAddr, (const uint32*)SrcAddr, ByteCnt/4);
+         }
+         else
+         {
+            RetStatus = MEM_SIZE32_WriteBlock((uint32*)DestCpuAddr, (const uint32*)SrcAddr, ByteCnt/4);
+         }
+         break;
+      case MEM_MGR_MemSize_VOID:
+         PspStatus = CFE_PSP_MemCpy((void*)DestCpuAddr, SrcAddr, ByteCnt);
+         RetStatus = (PspStatus == CFE_PSP_SUCCESS);
+         if (!RetStatus)
+         {
+            CFE_EVS_SendEvent(MEMORY_WRITE_BLOCK_EID, CFE_EVS_EventType_ERROR,
+                              "Write block memory copy failed for destination address %p, byte count %u, status=0x%08X",
+                              (void *)DestCpuAddr, (unsigned int)ByteCnt, (unsigned int)PspStatus);
+         }
+         break;
+      default:
+         CFE_EVS_SendEvent(MEMORY_WRITE_BLOCK_EID, CFE_EVS_EventType_ERROR,
+                           "Write block failed for destination address %p, invalid memory size %d",
+                           (void *)DestCpuAddr, DestMemSize);
+         break;
+   } /* End mem size switch */
+   
+   return RetStatus;
+   
+} /* End MEMORY_WriteBlock() */
+
+
+/******************************************************************************
+** Function: AddModuleToSignature
+**
+** Notes:
+**   1. OS_ForEachObjectOfType() callback. A reloaded module is assigned a new
+**      OSAL ID so loading, unloading or reloading a module changes the
+**      signature.
+**
+*/
+static void AddModuleToSignature(osal_id_t ModuleId, void *Signature)
+{
+
+   uint32 *ModuleSignature = (uint32 *)Signature;
+   
+   *ModuleSignature = (*ModuleSignature * 31) + (uint32)OS_ObjectIdToInteger(ModuleId);
+
+} /* End AddModuleToSignature() */
+
+
+/******************************************************************************
+** Function: AddSymCacheEntry
+**
+** Notes:
+**   1. The caller must own the cache mutex.
+**   2. If the symbol's probe sequence is full the first entry in the sequence
+**      is replaced. Entries are never removed so this does not break the
+**      probe sequence of other symbols.
+**
+*/
+static void AddSymCacheEntry(const char *SymbolName, uint32 Hash, cpuaddr Addr)
+{
+
+   uint32 i;
+   uint32 Index = Hash % MEM_MGR_SYM_CACHE_ENTRIES;
+   MEMORY_SymCacheEntry_t *Entry = &Memory->SymCache.Entry[Index];
+   
+   for (i=0; i < MEMORY_SYM_CACHE_PROBES; i++)
+   {
+      if (Memory->SymCache.Entry[Index].Name[0] == '\0')
+      {
+         Entry = &Memory->SymCache.Entry[Index];
+         break;
+      }
+      Index = (Index + 1) % MEM_MGR_SYM_CACHE_ENTRIES;
+   }
+   
+   Entry->Hash = Hash;
+   Entry->Addr = Addr;
+   strncpy(Entry->Name, SymbolName, MEM_MGR_MAX_SYM_LEN - 1);
+   Entry->Name[MEM_MGR_MAX_SYM_LEN - 1] = '\0';
+
+} /* End AddSymCacheEntry() */
+
+
 /******************************************************************************
 ** Function: CreateCpuAddr
 **
@@ -530,7 +1105,7 @@ static bool CreateCpuAddr(MEM_MGR_SymbolAddr_t *SymbolAddr, MEM_MGR_CpuAddr_Atom
    else
    {
       // If SymbolName string is not NULL then use offset is applied to symbol address
-      OsStatus = OS_SymbolLookup(CpuAddr, SymbolAddr->Name);
+      OsStatus = LookupSymbol(CpuAddr, SymbolAddr->Name);
       if (OsStatus == OS_SUCCESS)
       {
          *CpuAddr += SymbolAddr->Offset;
@@ -589,6 +1164,96 @@ static bool FillMemBlock(MEM_MGR_CpuAddr_Atom_t DestAddr, MEM_MGR_MemSize_Enum_t
 } /* End FillMemBlock() */
 
 
+/******************************************************************************
+** Function: CheckModuleSignature
+**
+** Notes:
+**   1. The caller must own the cache mutex.
+**   2. Flush the cache if the set of loaded OS modules has changed since the
+**      last check.
+**
+*/
+static void CheckModuleSignature(void)
+{
+
+   uint32 ModuleSignature = GetModuleSignature();
+   
+   if (ModuleSignature != Memory->SymCache.ModuleSignature)
+   {
+      FlushSymCache();
+      Memory->SymCache.ModuleSignature = ModuleSignature;
+   }
+
+} /* End CheckModuleSignature() */
+
+
+/******************************************************************************
+** Function: FindSymCacheEntry
+**
+** Notes:
+**   1. The caller must own the cache mutex.
+**   2. Returns NULL if the symbol is not in the cache.
+**
+*/
+static MEMORY_SymCacheEntry_t *FindSymCacheEntry(const char *SymbolName, uint32 Hash)
+{
+
+   uint32 i;
+   uint32 Index = Hash % MEM_MGR_SYM_CACHE_ENTRIES;
+   MEMORY_SymCacheEntry_t *Entry;
+   MEMORY_SymCacheEntry_t *FoundEntry = NULL;
+   
+   for (i=0; i < MEMORY_SYM_CACHE_PROBES; i++)
+   {
+      Entry = &Memory->SymCache.Entry[Index];
+      if (Entry->Name[0] == '\0')
+      {
+         break;
+      }
+      if ((Entry->Hash == Hash) && (strncmp(Entry->Name, SymbolName, MEM_MGR_MAX_SYM_LEN) == 0))
+      {
+         FoundEntry = Entry;
+         break;
+      }
+      Index = (Index + 1) % MEM_MGR_SYM_CACHE_ENTRIES;
+   }
+   
+   return FoundEntry;
+
+} /* End FindSymCacheEntry() */
+
+
+/******************************************************************************
+** Function: FlushSymCache
+**
+** Notes:
+**   1. The caller must own the cache mutex.
+**
+*/
+static void FlushSymCache(void)
+{
+
+   memset(Memory->SymCache.Entry, 0, sizeof(Memory->SymCache.Entry));
+
+} /* End FlushSymCache() */
+
+
+/******************************************************************************
+** Function: GetModuleSignature
+**
+*/
+static uint32 GetModuleSignature(void)
+{
+
+   uint32 Signature = 1;
+   
+   OS_ForEachObjectOfType(OS_OBJECT_TYPE_OS_MODULE, OS_OBJECT_CREATOR_ANY, AddModuleToSignature, &Signature);
+   
+   return Signature;
+
+} /* End GetModuleSignature() */
+
+
 /******************************************************************************
 ** Function: GetPspMemType
 **
@@ -627,6 +1292,85 @@ static bool GetPspMemType(MEM_MGR_MemType_Enum_t MemType, uint32 *PspMemType, ch
 } /* End GetPspMemType() */
 
 
+/******************************************************************************
+** Function: HashSymbolName
+**
+** Notes:
+**   1. 32-bit FNV-1a hash
+**
+*/
+static uint32 HashSymbolName(const char *SymbolName)
+{
+
+   uint32 Hash = 2166136261u;
+   
+   while (*SymbolName != '\0')
+   {
+      Hash ^= (uint8)*SymbolName++;
+      Hash *= 16777619u;
+   }
+   
+   return Hash;
+
+} /* End HashSymbolName() */
+
+
+/******************************************************************************
+** Function: LookupSymbol
+**
+** Notes:
+**   1. Same return status as OS_SymbolLookup(). Only successful lookups are
+**      cached.
+**   2. The OS module table is only checked on a miss since a miss already
+**      pays for an OS symbol table search. Hits rely on the periodic check
+**      in MEMORY_ManageSymCache() and the flush command.
+**
+*/
+static int32 LookupSymbol(cpuaddr *SymbolAddr, const char *SymbolName)
+{
+
+   int32   OsStatus = OS_SUCCESS;
+   uint32  Hash;
+   MEMORY_SymCache_t      *SymCache = &Memory->SymCache;
+   MEMORY_SymCacheEntry_t *Entry;
+   
+   if (SymCache->Enabled)
+   {
+   
+      Hash = HashSymbolName(SymbolName);
+      
+      OS_MutSemTake(SymCache->MutexId);
+      
+      Entry = FindSymCacheEntry(SymbolName, Hash);
+      if (Entry != NULL)
+      {
+         *SymbolAddr = Entry->Addr;
+         SymCache->HitCnt++;
+      }
+      else
+      {
+         SymCache->MissCnt++;
+         CheckModuleSignature();
+         OsStatus = OS_SymbolLookup(SymbolAddr, SymbolName);
+         if (OsStatus == OS_SUCCESS)
+         {
+            AddSymCacheEntry(SymbolName, Hash, *SymbolAddr);
+         }
+      }
+      
+      OS_MutSemGive(SymCache->MutexId);
+   
+   } /* End if cache enabled */
+   else
+   {
+      OsStatus = OS_SymbolLookup(SymbolAddr, SymbolName);
+   }
+   
+   return OsStatus;
+
+} /* End LookupSymbol() */
+
+
 /******************************************************************************
 ** Function: Peek
 **
@@ -737,95 +1481,45 @@ static bool Poke(MEM_MGR_CpuAddr_Atom_t CpuAddr, MEM_MGR_MemType_Enum_t MemType,
 } /* End Poke() */
 
 
-/******************************************************************************
-** Function: ReadMemBlock
-**
-** Notes:
-**   1. Copy a block of memory from a memory type/size to a local RAM buffer.
-**      This function is typically used for commanded memory types/sizes.
-**   2. From an OO design perspective this is a virtual function dispatcher
-**
-*/
-static bool ReadMemBlock(void *DestAddr, MEM_MGR_CpuAddr_Atom_t SrcCpuAddr,  
-                         MEM_MGR_MemSize_Enum_t SrcMemSize, uint32 ByteCnt)
-{
-
-   bool   RetStatus = false;
-   int32  PspStatus;
-   
-   switch (SrcMemSize)
-   {
-      case MEM_MGR_MemSize_8:
-         RetStatus = MEM_SIZE8_ReadBlock((uint8*)SrcCpuAddr, (uint8*)DestAddr, ByteCnt);
-         break;
-      case MEM_MGR_MemSize_16:
-         RetStatus = MEM_SIZE16_ReadBlock((uint16*)SrcCpuAddr, (uint16*)DestAddr, ByteCnt/2);
-         break;
-      case MEM_MGR_MemSize_32:
-         RetStatus = MEM_SIZE32_ReadBlock((uint32*)SrcCpuAddr, (uint32*)DestAddr, ByteCnt/4);
-         break;
-      case MEM_MGR_MemSize_VOID:
-         PspStatus = CFE_PSP_MemCpy((void*)DestAddr, (void*)SrcCpuAddr, ByteCnt);
-         RetStatus = (PspStatus == CFE_PSP_SUCCESS);
-         //TODO: Event
-         break;
-      default:
-         //TODO: Event
-         break;
-   } /* End mem size switch */
-
-   return RetStatus;
-    
-} /* End ReadMemBlock() */
-
-
 /******************************************************************************
 ** Function: SendDumpBufToEvent
 **
 ** Notes:
 **   1. Build and send the event message containing the dump data
-**   2. Refer to app_cfg.h's macro definition comments for 
+**   2. Refer to app_cfg.h's macro definition comments for the event string
+**      format. The caller must limit ByteCnt to MEMORY_DUMP_TOEVENT_MAX_BYTES
+**      so the hex string always fits in the event string.
+**   3. Each byte is hex encoded with a lookup table and appended at the end
+**      of the string so the string is built in linear time.
 **
 */
 static bool SendDumpBufToEvent(MEM_MGR_CpuAddr_Atom_t CpuAddr, const uint8 *DumpBuf, uint32 ByteCnt)
 {
 
-   bool   RetStatus = false;
-
-   const char  EventHdrStr[] = MEMORY_DUMP_TOEVENT_HDR_STR;
+   static const char HexDigit[] = "0123456789ABCDEF";
    static char EventStr[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-   char        TempStr[MEMORY_DUMP_TOEVENT_TEMP_CHARS];
-   int32       EventStrTotalLen = 0;
-   uint8*      EventStrBytePtr;
+   char       *EventStrPtr = EventStr;
    uint32      i;
       
   
-   strncpy(EventStr, EventHdrStr, sizeof(EventStr));
-   EventStrTotalLen = MEM_MGR_strnlen(EventStr, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+   memcpy(EventStrPtr, MEMORY_DUMP_TOEVENT_HDR_STR, sizeof(MEMORY_DUMP_TOEVENT_HDR_STR) - 1);
+   EventStrPtr += sizeof(MEMORY_DUMP_TOEVENT_HDR_STR) - 1;
 
-   EventStrBytePtr = (uint8*)DumpToEventBuf;
    for (i=0; i < ByteCnt; i++)
    {
-      // No need to check snprintf return, CFE_SB_MessageStringGet() handles safe concatenation & prevents overflow
-      snprintf(TempStr, MEMORY_DUMP_TOEVENT_TEMP_CHARS, "0x%02X ", *EventStrBytePtr);
-      CFE_SB_MessageStringGet(&EventStr[EventStrTotalLen], TempStr, NULL,sizeof(EventStr)-EventStrTotalLen, sizeof(TempStr));
-      EventStrTotalLen = MEM_MGR_strnlen(EventStr, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-      EventStrBytePtr++;
+      *EventStrPtr++ = '0';
+      *EventStrPtr++ = 'x';
+      *EventStrPtr++ = HexDigit[DumpBuf[i] >> 4];
+      *EventStrPtr++ = HexDigit[DumpBuf[i] & 0x0F];
+      *EventStrPtr++ = ' ';
    } 
    
-   /* 
-   ** Append tail
-   ** This adds up to 33 characters depending on pointer representation including the NUL terminator
-   ** SAD: No need to check snprintf return; CFE_SB_MessageStringGet() handles safe concatenation and
-   ** prevents overflow
-   */
-   snprintf(TempStr, MEMORY_DUMP_TOEVENT_TEMP_CHARS, MEMORY_DUMP_TOEVENT_TRAILER_STR, (void *)CpuAddr);
-   CFE_SB_MessageStringGet(&EventStr[EventStrTotalLen], TempStr, NULL,
-                           sizeof(EventStr) - EventStrTotalLen, sizeof(TempStr));
+   /* snprintf() truncates the trailer if a pointer is wider than expected */
+   snprintf(EventStrPtr, sizeof(EventStr) - (EventStrPtr - EventStr), MEMORY_DUMP_TOEVENT_TRAILER_STR, (void *)CpuAddr);
 
    CFE_EVS_SendEvent(MEMORY_DUMP_TO_EVENT_EID, CFE_EVS_EventType_INFORMATION, "%s", EventStr);
 
-   return RetStatus;
+   return true;
 
 } /* End SendDumpBufToEvent() */
 
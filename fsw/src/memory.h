@@ -29,6 +29,7 @@
 */
 
 #include "app_cfg.h"
+#include "mem_map.h"
 
 /***********************/
 /** Macro Definitions **/
@@ -50,6 +51,11 @@
 #define MEMORY_CREATE_CPU_ADDR_EID   (MEMORY_BASE_EID + 8)
 #define MEMORY_GET_PSP_MEM_TYPE_EID  (MEMORY_BASE_EID + 9)
 #define MEMORY_VER_CPU_ADDR_EID      (MEMORY_BASE_EID + 10)
+#define MEMORY_SYM_CACHE_EID         (MEMORY_BASE_EID + 11)
+#define MEMORY_PATTERN_FILL_EID      (MEMORY_BASE_EID + 12)
+#define MEMORY_PEEK_LIST_EID         (MEMORY_BASE_EID + 13)
+#define MEMORY_READ_BLOCK_EID        (MEMORY_BASE_EID + 14)
+#define MEMORY_WRITE_BLOCK_EID       (MEMORY_BASE_EID + 15)
 
 
 /**********************/
@@ -61,6 +67,7 @@ typedef struct
 {
    MEM_MGR_CpuAddr_Atom_t   CpuAddr;
    char                    *TypeStr;
+   bool                     DirectAccess;  // RAM that can be accessed without PSP calls
       
 } MEMORY_VerifiedMemory_t;
 
@@ -82,11 +89,42 @@ typedef struct
 } MEMORY_CmdStatus_t;
 
     
+/*
+** An entry is unused when Name is an empty string. Entries are only removed
+** by flushing the entire cache so an unused entry ends a probe sequence. 
+*/
+typedef struct
+{
+   uint32   Hash;
+   cpuaddr  Addr;
+   char     Name[MEM_MGR_MAX_SYM_LEN];
+   
+} MEMORY_SymCacheEntry_t;
+
+
+typedef struct
+{
+   bool       Enabled;          // False if the cache mutex could not be created
+   osal_id_t  MutexId;          // Symbols are resolved by the app and child tasks
+   uint32     ModuleSignature;  // Identifies the set of loaded OS modules
+   uint32     HitCnt;
+   uint32     MissCnt;
+
+   MEMORY_SymCacheEntry_t Entry[MEM_MGR_SYM_CACHE_ENTRIES];
+   
+} MEMORY_SymCache_t;
+
+    
 typedef struct
 {
    bool EepromWriteEna;
    
+   uint32 FillChildThreshold;  // Fills with more bytes are performed by the child task
+
    MEMORY_CmdStatus_t CmdStatus;
+   MEMORY_SymCache_t  SymCache;
+
+   MEM_MGR_PeekListTlm_t  PeekListTlm;
       
 } MEMORY_Class_t;
 
@@ -105,7 +143,7 @@ typedef struct
 **   1. This must be called prior to any other function.
 **
 */
-void MEMORY_Constructor(MEMORY_Class_t *MemoryPtr);
+void MEMORY_Constructor(MEMORY_Class_t *MemoryPtr, const INITBL_Class_t *IniTbl);
 
 
 /******************************************************************************
@@ -135,10 +173,29 @@ bool MEMORY_EnaEepromWriteCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
 /******************************************************************************
 ** Function: MEMORY_FillCmd
 **
+** Notes:
+**   1. DataObjPtr must be the app's CHILDMGR object. Fills with more than
+**      FillChildThreshold bytes are sent to the child task, see
+**      MEM_REGION_FillCmd().
+**
 */
 bool MEMORY_FillCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr);
 
 
+/******************************************************************************
+** Function: MEMORY_FlushSymCacheCmd
+**
+** Notes:
+**   1. The cache is automatically flushed when a change in the set of loaded
+**      OS modules is detected by a cache miss or MEMORY_ManageSymCache().
+**      This command flushes immediately, for example after a module reload
+**      or for symbol changes that can't be detected such as a module that is
+**      reloaded at a different address without creating a new OS module.
+**
+*/
+bool MEMORY_FlushSymCacheCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr);
+
+
 /******************************************************************************
 ** Function: MEMORY_LoadWithIntDisCmds
 **
@@ -156,6 +213,31 @@ bool MEMORY_LoadWithIntDisCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr)
 bool MEMORY_LookupSymbolCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr);
 
 
+/******************************************************************************
+** Function: MEMORY_ManageSymCache
+**
+** Notes:
+**   1. Flush the symbol cache if the set of loaded OS modules has changed.
+**      Walking the OS module table costs about as much as a symbol lookup so
+**      it is called periodically rather than on every cache hit.
+**
+*/
+void MEMORY_ManageSymCache(void);
+
+
+/******************************************************************************
+** Function: MEMORY_PatternFillCmd
+**
+** Notes:
+**   1. Fill memory with a repeated pattern of up to MEM_FILL_PATTERN_MAX_LEN
+**      bytes or a generated pattern. See MEM_MGR_FillPattern in the EDS.
+**   2. Same child task rules as MEMORY_FillCmd(), see
+**      MEM_REGION_PatternFillCmd().
+**
+*/
+bool MEMORY_PatternFillCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr);
+
+
 /******************************************************************************
 ** Function: MEMORY_PeekCmd
 **
@@ -168,6 +250,20 @@ bool MEMORY_LookupSymbolCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr);
 bool MEMORY_PeekCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr);
 
 
+/******************************************************************************
+** Function: MEMORY_PeekListCmd
+**
+** Notes:
+**   1. Every entry is verified before any memory is read so the command
+**      either reads all of the entries or none of them.
+**   2. The entries are read back-to-back without sending events, optionally
+**      with the platform's interrupt lock, and all of the values are sent in
+**      a single PeekListTlm packet.
+**
+*/
+bool MEMORY_PeekListCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr);
+
+
 /******************************************************************************
 ** Function: MEMORY_PokeCmd
 **
@@ -180,9 +276,41 @@ bool MEMORY_PeekCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr);
 bool MEMORY_PokeCmd(void *DataObjPtr, const CFE_MSG_Message_t *MsgPtr);
 
 
+/******************************************************************************
+** Function: MEMORY_ReadBlock
+**
+** Notes:
+**   1. Read ByteCnt bytes from SrcCpuAddr into a local RAM buffer using
+**      SrcMemSize memory accesses. The address must be verified by
+**      MEMORY_VerifyAddr() prior to calling this function.
+**   2. DirectAccess should be set to MEMORY_VerifyAddr()'s DirectAccess
+**      result. If true, memory is read without PSP calls.
+**
+*/
+bool MEMORY_ReadBlock(void *DestAddr, MEM_MGR_CpuAddr_Atom_t SrcCpuAddr,  
+                      MEM_MGR_MemSize_Enum_t SrcMemSize, uint32 ByteCnt, bool DirectAccess);
+
+
+/******************************************************************************
+** Function: MEMORY_ReadValue
+**
+** Notes:
+**   1. Read a single 8, 16 or 32-bit memory location. The address must be
+**      verified by MEMORY_VerifyAddr() prior to calling this function.
+**   2. No events are sent so this can be called with interrupts locked. The
+**      PSP status is returned and DirectAccess reads always succeed.
+**
+*/
+int32 MEMORY_ReadValue(MEM_MGR_CpuAddr_Atom_t CpuAddr, MEM_MGR_MemSize_Enum_t MemSize,
+                       bool DirectAccess, uint32 *Value);
+
+
 /******************************************************************************
 ** Function:  MEMORY_ResetStatus
 **
+** Notes:
+**   1. Resets the symbol cache hit and miss counters.
+**
 */
 void MEMORY_ResetStatus(void);
 
@@ -206,11 +334,31 @@ void MEMORY_SetCmdStatus(const MEMORY_CmdStatus_t *CmdStatus);
 ** Notes:
 **   1. This is the top-level address verification function that is called by
 **      command functions.
+**   2. Access is a MEM_MAP_ACCESS_x bit mask. If the memory map is enabled the
+**      address is verified using the map, otherwise it's verified by the PSP.
+**   3. Verified RAM is marked for direct access unless the memory map defines
+**      it as memory mapped I/O. NONVOL and MMIO memory is accessed using one
+**      PSP call per memory access.
 **
 */
 bool MEMORY_VerifyAddr(MEM_MGR_SymbolAddr_t SymbolAddr, MEM_MGR_MemType_Enum_t MemType, 
-                       MEM_MGR_MemSize_Enum_t MemSize, uint32 ByteCnt, 
+                       MEM_MGR_MemSize_Enum_t MemSize, uint32 ByteCnt, uint8 Access,
                        MEMORY_VerifiedMemory_t *VerifiedMemory);
 
 
+/******************************************************************************
+** Function: MEMORY_WriteBlock
+**
+** Notes:
+**   1. Write ByteCnt bytes from a local RAM buffer to DestCpuAddr using
+**      DestMemSize memory accesses. The address must be verified by
+**      MEMORY_VerifyAddr() prior to calling this function.
+**   2. DirectAccess should be set to MEMORY_VerifyAddr()'s DirectAccess
+**      result. If true, memory is written without PSP calls.
+**
+*/
+bool MEMORY_WriteBlock(MEM_MGR_CpuAddr_Atom_t DestCpuAddr, MEM_MGR_MemSize_Enum_t DestMemSize,
+                       const void *SrcAddr, uint32 ByteCnt, bool DirectAccess);
+
+
 #endif /* _memory_ */